@@ -1,9 +1,11 @@
 #pragma once
 
+#include "PlanarImage.h"
 #include "Utils.h"
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <vector>
 
 namespace AnamorphicStreak {
 
@@ -13,47 +15,13 @@ struct Params {
   double threshold; // Highlight isolation threshold
   double length;    // 0..1, horizontal streak length (maps to blur radius)
   double tint;      // -1 (cool/blue) to +1 (warm/orange)
+  int points;       // 0..3: 2, 4, 6 or 8 points (see Star below)
+  double angle;     // Degrees, rotation of the first arm from horizontal
+  // Arms 2..4 of a star: length and tint as for the first
+  double armLength[3];
+  double armTint[3];
 };
 
-// Horizontal-only box blur — 1D sliding window, O(W*H)
-inline void boxBlurH1D(const float *__restrict__ src, float *__restrict__ dst,
-                       int w, int h, int r) {
-  if (r < 1) {
-    std::memcpy(dst, src, (size_t)w * h * 4 * sizeof(float));
-    return;
-  }
-  const float invK = 1.0f / (float)(2 * r + 1);
-  const int stride = w * 4;
-
-  for (int y = 0; y < h; ++y) {
-    const float *row = src + y * stride;
-    float *out = dst + y * stride;
-
-    float sumR = row[0] * (r + 1);
-    float sumG = row[1] * (r + 1);
-    float sumB = row[2] * (r + 1);
-    for (int i = 1; i <= r; ++i) {
-      int px = std::min(i, w - 1) * 4;
-      sumR += row[px + 0];
-      sumG += row[px + 1];
-      sumB += row[px + 2];
-    }
-
-    for (int x = 0; x < w; ++x) {
-      out[x * 4 + 0] = sumR * invK;
-      out[x * 4 + 1] = sumG * invK;
-      out[x * 4 + 2] = sumB * invK;
-      out[x * 4 + 3] = row[x * 4 + 3];
-
-      int addIdx = std::min(x + r + 1, w - 1) * 4;
-      int subIdx = std::max(x - r, 0) * 4;
-      sumR += row[addIdx + 0] - row[subIdx + 0];
-      sumG += row[addIdx + 1] - row[subIdx + 1];
-      sumB += row[addIdx + 2] - row[subIdx + 2];
-    }
-  }
-}
-
 // Isolate highlights and compute streak source
 inline void computeStreakSource(float r, float g, float b, float &outR,
                                 float &outG, float &outB,
@@ -70,6 +38,32 @@ inline void computeStreakSource(float r, float g, float b, float &outR,
   outB = b * mask;
 }
 
+// Number of arms through the centre: half the star's points
+inline int armCount(const Params &params) {
+  return std::min(std::max(params.points, 0), 3) + 1;
+}
+
+// A plain horizontal streak runs the row blur below; anything else is a star
+inline bool isStar(const Params &params) {
+  return armCount(params) > 1 || params.angle != 0.0;
+}
+
+// Per-channel streak gains for a warmth/coolness tint
+inline void tintWeights(float tint, float w[3]) {
+  w[0] = w[1] = w[2] = 1.0f;
+  if (tint > 0.0f) {
+    // Warm: boost R, slight G, reduce B
+    w[0] = 1.0f + tint * 0.3f;
+    w[1] = 1.0f + tint * 0.1f;
+    w[2] = 1.0f - tint * 0.2f;
+  } else if (tint < 0.0f) {
+    // Cool: reduce R, boost B
+    float ct = -tint;
+    w[0] = 1.0f - ct * 0.2f;
+    w[2] = 1.0f + ct * 0.3f;
+  }
+}
+
 // Apply the blurred streak with optional color tint
 inline void applyStreak(float &r, float &g, float &b, float sR, float sG,
                         float sB, const Params &params) {
@@ -77,19 +71,16 @@ inline void applyStreak(float &r, float &g, float &b, float sR, float sG,
     return;
 
   float amt = (float)params.amount;
-  float tint = (float)params.tint;
 
-  // Apply warmth/coolness tint to the streak
-  if (tint > 0.0f) {
-    // Warm: boost R, slight G, reduce B
-    sR *= (1.0f + tint * 0.3f);
-    sG *= (1.0f + tint * 0.1f);
-    sB *= (1.0f - tint * 0.2f);
-  } else if (tint < 0.0f) {
-    // Cool: reduce R, boost B
-    float ct = -tint;
-    sR *= (1.0f - ct * 0.2f);
-    sB *= (1.0f + ct * 0.3f);
+  // Apply warmth/coolness tint to the streak (a star's arms carry their own,
+  // applied as they are accumulated)
+  const float tint = isStar(params) ? 0.0f : (float)params.tint;
+  if (tint != 0.0f) {
+    float w[3];
+    tintWeights(tint, w);
+    sR *= w[0];
+    sG *= w[1];
+    sB *= w[2];
   }
 
   // Additive blend (screen-like for highlights)
@@ -98,4 +89,442 @@ inline void applyStreak(float &r, float &g, float &b, float sR, float sG,
   b += sB * amt;
 }
 
+// ============================================================================
+// Streak blur — horizontal, one row at a time
+//
+// The streak kernel is three boxes of radius len (Final / Normal) or one box
+// of the same variance (Draft). The three run back to back on each row in
+// scratch, as running sums whose cost does not depend on the radius, so the
+// layer is read and written once instead of three times. Beyond the row the
+// input is extended with its edge values; the Pipeline gives the streak a
+// horizontal apron of reach(len), so those only stand in for pixels outside
+// the source. R, G and B are slid together so their add chains overlap.
+//
+// The spans the three boxes need grow with the length, so Final streaks
+// longer than kDirectMaxLen run at the top of a 1D pyramid of the row —
+// pair averages, halved until the radius left is kDownMinLen to
+// 2*kDownMinLen — and come back through 2x linear upsamples. Their cost
+// then stays at that of a short streak (measured flat from 256 to 2048 px
+// at 4K and 8K); at those lengths the kernel is hundreds of pixels wide and
+// nothing of it is lost. Draft's single box is cheaper than the pyramid at
+// any length and always runs directly.
+// ============================================================================
+
+static constexpr int kDirectMaxLen = 256;
+static constexpr int kDownMinLen = 64;
+
+// Pixels the streak reaches on either side, horizontally
+inline int reach(int len) { return 3 * len; }
+
+// Radius of the single box matching the variance of three of radius len
+inline int oneBoxRadius(int len) {
+  const float k = (float)(2 * len + 1);
+  return std::max(
+      1, (int)std::round((std::sqrt(3.0f * (k * k - 1.0f) + 1.0f) - 1.0f) *
+                         0.5f));
+}
+
+struct RowScratch {
+  std::vector<float> a, b, down, downOut;
+};
+
+// Box of radius r over N rows of n values at positions [in0, in0 + n),
+// edge-extended, evaluated at positions [o0, o0 + m). out must not alias in.
+template <int N>
+inline void slideBox(const float *const inRows[N], int in0, int n, int r,
+                     int o0, int m, float *const outRows[N]) {
+  const float invK = 1.0f / (float)(2 * r + 1);
+  auto at = [&](int pos) { return std::min(std::max(pos - in0, 0), n - 1); };
+  // Local copies keep the row pointers in registers across the stores
+  const float *__restrict__ in[N];
+  float *__restrict__ out[N];
+  float sum[N];
+  for (int k = 0; k < N; ++k) {
+    in[k] = inRows[k];
+    out[k] = outRows[k];
+    sum[k] = 0.0f;
+    for (int i = -r; i <= r; ++i)
+      sum[k] += in[k][at(o0 + i)];
+  }
+  for (int x = 0; x < m; ++x) {
+    const int addIdx = at(o0 + x + r + 1);
+    const int subIdx = at(o0 + x - r);
+    for (int k = 0; k < N; ++k) {
+      out[k][x] = sum[k] * invK;
+      sum[k] += in[k][addIdx] - in[k][subIdx];
+    }
+  }
+}
+
+// Streak kernel over N rows of w values, at full resolution
+template <int N>
+inline void blurRowsDirect(const float *const in[N], int w, int len,
+                           bool oneBox, float *const out[N], RowScratch &s) {
+  if (oneBox) {
+    slideBox<N>(in, 0, w, oneBoxRadius(len), 0, w, out);
+    return;
+  }
+  // Each box narrows the span it needs by len: [-2len, w + 2len) ->
+  // [-len, w + len) -> [0, w), so only the first reads past the row
+  const int wa = w + 4 * len, wb = w + 2 * len;
+  s.a.resize((size_t)N * wa);
+  s.b.resize((size_t)N * wb);
+  float *a[N], *b[N];
+  for (int k = 0; k < N; ++k) {
+    a[k] = s.a.data() + (size_t)k * wa;
+    b[k] = s.b.data() + (size_t)k * wb;
+  }
+  slideBox<N>(in, 0, w, len, -2 * len, wa, a);
+  slideBox<N>(a, -2 * len, wa, len, -len, wb, b);
+  slideBox<N>(b, -len, wb, len, 0, w, out);
+}
+
+// Levels of the 1D pyramid blurRows runs a streak of length len through
+// (0: it runs directly). The first pair average is taken at the row's first
+// value, so rows starting 1 << levels apart are blurred alike.
+inline int rowLevels(int len, bool oneBox) {
+  if (oneBox || len <= kDirectMaxLen)
+    return 0;
+  // Halve until the radius left is below 2 * kDownMinLen
+  int levels = 1;
+  while ((len >> (levels + 1)) >= kDownMinLen)
+    ++levels;
+  return levels;
+}
+
+// Streak kernel over N rows of w values; out must not alias in
+template <int N>
+inline void blurRows(const float *const in[N], int w, int len, bool oneBox,
+                     float *const out[N], RowScratch &s) {
+  const int levels = rowLevels(len, oneBox);
+  if (levels == 0) {
+    blurRowsDirect<N>(in, w, len, oneBox, out, s);
+    return;
+  }
+
+  int widths[32];
+  widths[0] = w;
+  size_t total = 0;
+  for (int l = 1; l <= levels; ++l) {
+    widths[l] = (widths[l - 1] + 1) / 2;
+    total += widths[l];
+  }
+  s.down.resize((size_t)N * total);
+  s.downOut.resize((size_t)N * total);
+
+  // Level l of row k lives at offset(l) in s.down (pair averages, going
+  // down) and s.downOut (blurred, coming back up)
+  auto offset = [&](int k, int l) {
+    size_t o = (size_t)k * total;
+    for (int i = 1; i < l; ++i)
+      o += widths[i];
+    return o;
+  };
+
+  for (int k = 0; k < N; ++k) {
+    const float *p = in[k];
+    for (int l = 1; l <= levels; ++l) {
+      float *d = s.down.data() + offset(k, l);
+      const int pw = widths[l - 1];
+      for (int j = 0; j < widths[l]; ++j)
+        d[j] = 0.5f * (p[2 * j] + p[std::min(2 * j + 1, pw - 1)]);
+      p = d;
+    }
+  }
+
+  const int top = widths[levels];
+  const float *d[N];
+  float *dOut[N];
+  for (int k = 0; k < N; ++k) {
+    d[k] = s.down.data() + offset(k, levels);
+    dOut[k] = s.downOut.data() + offset(k, levels);
+  }
+  blurRowsDirect<N>(d, top, (len + (1 << (levels - 1))) >> levels, false,
+                    dOut, s);
+
+  // Back up one level at a time: each pixel blends the coarse sample it
+  // sits in (3/4) with the nearer neighbour (1/4), pixel-centre aligned
+  for (int k = 0; k < N; ++k) {
+    for (int l = levels; l >= 1; --l) {
+      const float *c = s.downOut.data() + offset(k, l);
+      float *o = l > 1 ? s.downOut.data() + offset(k, l - 1) : out[k];
+      const int cw = widths[l], ow = widths[l - 1];
+      for (int j = 0; j < cw; ++j) {
+        const float left = c[std::max(j - 1, 0)];
+        const float right = c[std::min(j + 1, cw - 1)];
+        o[2 * j] = 0.75f * c[j] + 0.25f * left;
+        if (2 * j + 1 < ow)
+          o[2 * j + 1] = 0.75f * c[j] + 0.25f * right;
+      }
+    }
+  }
+}
+
+// Streak-blur the three planes of src into dst, rows split across sched.
+// Long streaks' row pyramids are phased on src's first column, which the
+// pipeline puts on a multiple of 32. src and dst must NOT alias.
+template <class T>
+inline void blur(const PlanarImageT<T> &src, PlanarImageT<T> &dst, int len,
+                 bool oneBox, const Utils::Scheduler *sched = nullptr) {
+  const int w = src.width();
+  const int h = src.height();
+  // Rows are independent; tasks are large so their scratch is set up rarely
+  const int rows = 64;
+  Utils::parallelFor(sched, (h + rows - 1) / rows, [&](int chunk) {
+    RowScratch s;
+    std::vector<float> scratch(Utils::scratchSize<T>((size_t)6 * w));
+    for (int y = chunk * rows; y < std::min(h, (chunk + 1) * rows); ++y) {
+      const float *in[3];
+      float *out[3];
+      for (int c = 0; c < 3; ++c) {
+        float *rs = scratch.data() + (size_t)2 * c * w;
+        in[c] = Utils::widenRow(src.row(c, y), rs, w);
+        out[c] = Utils::rowTarget(dst.row(c, y), rs + w);
+      }
+      blurRows<3>(in, w, len, oneBox, out, s);
+      for (int c = 0; c < 3; ++c)
+        Utils::narrowRow(dst.row(c, y), out[c], w);
+    }
+  });
+}
+
+// ============================================================================
+// Star — 2, 4, 6 or 8 points from line blurs
+//
+// A star is 1 to 4 arms through each highlight, spread evenly over 180
+// degrees from angle, each with its own length and tint. An arm is the
+// streak kernel run along lines of its slope: the lines are resampled into
+// rows (linearly between the two pixels each crosses), blurred by blurRows
+// at its usual cost whatever the length, then resampled back and added to
+// the result with the arm's tint. Arms steeper than 45 degrees read the
+// image transposed, stepping along y, so a line never moves more than a
+// pixel across per step. The source is extracted once for all arms, and
+// arms add up as stacked single streaks would.
+//
+// The lines lie on a lattice fixed in image coordinates, and rows long
+// enough for blurRows' pyramid start on a multiple of its stride there, so
+// a buffer resamples the same lines the same way wherever it starts: tiled
+// renders match full-frame ones.
+// ============================================================================
+
+struct Arm {
+  double angle; // Radians from horizontal
+  int len;      // Streak length along the arm, pixels
+  float tint;
+};
+
+// Arm a of the star at the given render scale
+inline Arm starArm(const Params &params, int a, double scale) {
+  const double kDegToRad = 3.14159265358979323846 / 180.0;
+  Arm arm;
+  arm.angle = (params.angle + 180.0 * a / armCount(params)) * kDegToRad;
+  const double length = a == 0 ? params.length : params.armLength[a - 1];
+  arm.len = std::max(1, (int)(length * 80.0 * scale));
+  arm.tint = (float)(a == 0 ? params.tint : params.armTint[a - 1]);
+  return arm;
+}
+
+// Pixels the streak or star reaches on either side, along x and along y
+inline void reachXY(const Params &params, double scale, int &rx, int &ry) {
+  rx = ry = 0;
+  if (!isStar(params)) {
+    rx = reach(starArm(params, 0, scale).len);
+    return;
+  }
+  for (int a = 0; a < armCount(params); ++a) {
+    const Arm arm = starArm(params, a, scale);
+    // Two more for rounding the length to steps and the resampling
+    const double d = reach(arm.len) + 2.0;
+    rx = std::max(rx, (int)std::ceil(d * std::abs(std::cos(arm.angle))));
+    ry = std::max(ry, (int)std::ceil(d * std::abs(std::sin(arm.angle))));
+  }
+}
+
+// Side of the square tiles the star's resampling works in
+static constexpr int kStarTile = 64;
+
+// Add one arm of the star to dst (first: dst holds nothing yet), with lines
+// as scratch; (ox, oy) is the image position of src's first pixel. In the
+// arm's frame, transposed for steep arms, u steps along the dominant axis
+// and line v is t = v + slope * u with |slope| <= 1. At a given u every
+// line is shifted by the same slope * u, so the whole and fractional parts
+// of the shift are tabled once per u.
+template <class T>
+inline void addArm(const PlanarImage &src, PlanarImageT<T> &dst,
+                   const Arm &arm, bool oneBox, bool first, int ox, int oy,
+                   std::vector<float> &lines,
+                   const Utils::Scheduler *sched) {
+  const int w = src.width();
+  const int h = src.height();
+  const double c = std::cos(arm.angle), s = std::sin(arm.angle);
+  const bool steep = std::abs(s) > std::abs(c);
+  double slope = steep ? c / s : s / c;
+  if (std::abs(slope) < 1e-9)
+    slope = 0.0; // Axis-aligned (cos 90 degrees is not quite 0)
+  const int lw = steep ? h : w, lh = steep ? w : h;
+  const size_t stepU = steep ? (size_t)w : 1, stepT = steep ? 1 : (size_t)w;
+  // One step along u covers 1 / max(|cos|, |sin|) pixels of the arm
+  const int len = std::max(
+      1, (int)std::round(arm.len * std::max(std::abs(c), std::abs(s))));
+
+  // Line k is v = vMin + k + phase, kept over [u0, u1): where it crosses
+  // the image (-1 < t < lh) and a pixel either side, so the two lines around
+  // any pixel always cover it. The phase puts the lines on integer v in
+  // image coordinates, and u0 is rounded down to a multiple of blurRows'
+  // stride there. (k, u) is at base[k] + u in each plane of lines.
+  const int ou = steep ? oy : ox, ot = steep ? ox : oy;
+  double phase = slope * ou - ot;
+  phase -= std::floor(phase);
+  const int stride = 1 << rowLevels(len, oneBox);
+  const double span = slope * (lw - 1);
+  const int vMin = (int)std::floor(std::min(0.0, -span)) - 1;
+  const int vMax = (int)std::ceil(std::max(0.0, -span)) + lh;
+  const int nLines = vMax - vMin + 1;
+  std::vector<int> u0(nLines), u1(nLines);
+  std::vector<ptrdiff_t> base(nLines);
+  size_t total = 0;
+  for (int k = 0; k < nLines; ++k) {
+    const double v = vMin + k + phase;
+    int a = 0, b = 0;
+    if (slope != 0.0) {
+      double lo = (-1.0 - v) / slope, hi = (lh - v) / slope;
+      if (lo > hi)
+        std::swap(lo, hi);
+      a = (int)std::min((double)lw, std::max(0.0, std::floor(lo) - 1.0));
+      b = (int)std::min((double)lw, std::max(0.0, std::ceil(hi) + 1.0));
+    } else if (v >= -1.0 && v <= lh) {
+      b = lw;
+    }
+    // The pipeline's buffers start on multiples of 32, so this stays in
+    // the buffer for any stride up to that (streaks up to 4096 px)
+    a = std::max(0, a - ((a + ou) % stride + stride) % stride);
+    u0[k] = a;
+    u1[k] = std::max(a, b);
+    base[k] = (ptrdiff_t)total - a;
+    total += (size_t)(u1[k] - u0[k]);
+  }
+  if (lines.size() < 3 * total)
+    lines.resize(3 * total);
+
+  // Shift tables: line k samples t = k + shiftI[u] + shiftF[u], and pixel
+  // (u, t) lies between lines t + backI[u] and t + backI[u] + 1
+  std::vector<int> shiftI(lw), backI(lw);
+  std::vector<float> shiftF(lw), backF(lw);
+  for (int u = 0; u < lw; ++u) {
+    const double sh = vMin + phase + slope * u, bk = -sh;
+    shiftI[u] = (int)std::floor(sh);
+    shiftF[u] = (float)(sh - shiftI[u]);
+    backI[u] = (int)std::floor(bk);
+    backF[u] = (float)(bk - backI[u]);
+  }
+
+  // Resample each line into its row. A line crosses the image diagonally,
+  // so lines are gathered a tile of u at a time: a tile of lines reads one
+  // small patch of the source, which its neighbouring lines find in cache.
+  const int rows = 64;
+  Utils::parallelFor(sched, (nLines + rows - 1) / rows, [&](int chunk) {
+    const int k1 = std::min(nLines, (chunk + 1) * rows);
+    for (int ub = 0; ub < lw; ub += kStarTile) {
+      for (int k = chunk * rows; k < k1; ++k) {
+        const int ue = std::min(u1[k], ub + kStarTile);
+        for (int u = std::max(u0[k], ub); u < ue; ++u) {
+          const int ti = k + shiftI[u];
+          const size_t ia = std::min(std::max(ti, 0), lh - 1) * stepT;
+          const size_t ib = std::min(std::max(ti + 1, 0), lh - 1) * stepT;
+          const size_t iu = u * stepU;
+          const float f = shiftF[u];
+          for (int ch = 0; ch < 3; ++ch) {
+            const float *p = src.plane(ch) + iu;
+            lines[ch * total + base[k] + u] = p[ia] + f * (p[ib] - p[ia]);
+          }
+        }
+      }
+    }
+    // Then blur them, through scratch since out must not alias in
+    RowScratch scratch;
+    std::vector<float> row((size_t)3 * lw);
+    for (int k = chunk * rows; k < k1; ++k) {
+      const int n = u1[k] - u0[k];
+      if (n == 0)
+        continue;
+      const float *in[3];
+      float *out[3];
+      for (int ch = 0; ch < 3; ++ch) {
+        in[ch] = lines.data() + ch * total + base[k] + u0[k];
+        out[ch] = row.data() + (size_t)ch * lw;
+      }
+      blurRows<3>(in, n, len, oneBox, out, scratch);
+      for (int ch = 0; ch < 3; ++ch)
+        std::memcpy(lines.data() + ch * total + base[k] + u0[k], out[ch],
+                    (size_t)n * sizeof(float));
+    }
+  });
+
+  // Back to pixels, tile by tile again, adding the arm with its tint
+  float tw[3];
+  tintWeights(arm.tint, tw);
+  Utils::parallelFor(sched, (h + rows - 1) / rows, [&](int chunk) {
+    std::vector<float> scratch(Utils::scratchSize<T>((size_t)3 * kStarTile));
+    for (int xb = 0; xb < w; xb += kStarTile) {
+      const int n = std::min(kStarTile, w - xb);
+      for (int y = chunk * rows; y < std::min(h, (chunk + 1) * rows); ++y) {
+        float *o[3];
+        for (int ch = 0; ch < 3; ++ch) {
+          T *seg = dst.row(ch, y) + xb;
+          float *rs = scratch.data() + (size_t)ch * kStarTile;
+          o[ch] = Utils::rowTarget(seg, rs);
+          if (first)
+            std::fill(o[ch], o[ch] + n, 0.0f);
+          else
+            Utils::widenRow(seg, rs, n);
+        }
+        const float *__restrict__ l[3] = {lines.data(), lines.data() + total,
+                                          lines.data() + 2 * total};
+        for (int i = 0; i < n; ++i) {
+          const int x = xb + i;
+          const int u = steep ? y : x, t = steep ? x : y;
+          const int k0 = t + backI[u];
+          const float f = backF[u];
+          const ptrdiff_t ia = base[k0] + u, ib = base[k0 + 1] + u;
+          for (int ch = 0; ch < 3; ++ch)
+            o[ch][i] += tw[ch] * (l[ch][ia] + f * (l[ch][ib] - l[ch][ia]));
+        }
+        for (int ch = 0; ch < 3; ++ch) {
+          T *seg = dst.row(ch, y) + xb;
+          Utils::saturateRow(seg, o[ch], n);
+          Utils::narrowRow(seg, o[ch], n);
+        }
+      }
+    }
+  });
+}
+
+// The arms resample the source at arbitrary positions, so an fp16 source is
+// widened once for all of them rather than value by value
+inline const PlanarImage &widened(const PlanarImage &src, PlanarImage &) {
+  return src;
+}
+inline const PlanarImage &widened(const PlanarImageHalf &src,
+                                  PlanarImage &wide) {
+  wide.allocate(src.width(), src.height());
+  for (int c = 0; c < 3; ++c)
+    Half::toFloat(src.plane(c), wide.plane(c), src.pixels());
+  return wide;
+}
+
+// Star-blur the three planes of src into dst: every arm of params at the
+// given render scale, tinted and summed. (ox, oy) is the image position of
+// src's first pixel. src and dst must NOT alias.
+template <class T>
+inline void star(const PlanarImageT<T> &src, PlanarImageT<T> &dst,
+                 const Params &params, double scale, bool oneBox, int ox,
+                 int oy, const Utils::Scheduler *sched = nullptr) {
+  PlanarImage wide;
+  const PlanarImage &in = widened(src, wide);
+  std::vector<float> lines;
+  for (int a = 0; a < armCount(params); ++a)
+    addArm(in, dst, starArm(params, a, scale), oneBox, a == 0, ox, oy, lines,
+           sched);
+}
+
 } // namespace AnamorphicStreak
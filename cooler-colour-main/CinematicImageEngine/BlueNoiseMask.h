@@ -0,0 +1,1382 @@
+#pragma once
+
+#include <cstdint>
+
+// Generated by tools/GenBlueNoiseMask.cpp; do not edit.
+// Rank (0..16383) of each pixel of the 128x128 blue-noise mask, row-major.
+
+namespace Dither {
+
+inline const uint16_t *blueNoiseRanks() {
+  static const uint16_t kRanks[16384] = {
+      9694, 10875, 4594, 13421, 3622, 10105, 152, 3110, 5842, 9837, 1166, 8273,
+      6616, 61, 15558, 9778, 12197, 14492, 8975, 4796, 11842, 3779, 12642, 15992,
+      8046, 4461, 6448, 15764, 5127, 8893, 583, 12705, 4996, 15055, 2168, 11734,
+      4185, 10636, 6710, 3474, 10886, 7035, 11928, 1349, 3486, 7560, 12393, 6496,
+      15708, 9147, 2276, 14818, 920, 7879, 15406, 4649, 14661, 6847, 8875, 846,
+      3455, 14376, 1742, 8348, 3112, 13221, 9319, 15788, 13738, 11784, 7823, 13357,
+      5772, 9292, 3707, 134, 10487, 2082, 3575, 5475, 9921, 14618, 4295, 12202,
+      7456, 2765, 6374, 4934, 987, 16228, 10484, 5577, 9363, 15318, 4955, 9954,
+      16265, 4177, 14908, 416, 14006, 4092, 16092, 888, 12296, 4337, 11155, 2871,
+      8266, 985, 7057, 15841, 13143, 9744, 14519, 11650, 16056, 9588, 3286, 14786,
+      1238, 11663, 3128, 13978, 5011, 1037, 11480, 14422, 1571, 16292, 2614, 7010,
+      9099, 14755, 12173, 7620, 11526, 14214, 5135, 12064, 10374, 4626, 12902, 2220,
+      4140, 6251, 447, 7710, 15532, 6178, 777, 3107, 9831, 260, 12577, 8423,
+      1892, 15140, 11346, 6290, 3357, 8842, 13166, 5612, 7871, 710, 13245, 8695,
+      15587, 2411, 14650, 6190, 13531, 10681, 14757, 4699, 1231, 13460, 7480, 4502,
+      10674, 3338, 5791, 12079, 10370, 2394, 11483, 13214, 6162, 10620, 4831, 13852,
+      11413, 7848, 1019, 5194, 2006, 6546, 334, 2890, 14811, 11498, 7135, 13448,
+      15135, 7946, 11205, 13722, 352, 8236, 10731, 1197, 15456, 10237, 14915, 11076,
+      7225, 4158, 8184, 196, 12489, 2841, 13636, 663, 6241, 8049, 11479, 5680,
+      7071, 2284, 9683, 6351, 8344, 2218, 7030, 16028, 10396, 4040, 11667, 8821,
+      751, 3688, 5225, 1573, 5954, 105, 13736, 4987, 12910, 9834, 6340, 8633,
+      2348, 15577, 3736, 5510, 13041, 7665, 11638, 14080, 1378, 6500, 4274, 15979,
+      893, 9024, 3749, 15429, 1807, 14134, 8646, 6881, 16043, 10778, 13871, 9941,
+      2531, 10537, 13954, 6730, 15042, 11074, 3668, 14045, 10331, 4518, 2598, 9712,
+      14413, 7375, 381, 15731, 2963, 14764, 9905, 1262, 5573, 12932, 9357, 4405,
+      8359, 841, 2664, 8777, 10846, 3835, 11970, 16266, 6458, 13922, 9115, 1029,
+      7540, 3862, 15570, 7982, 2146, 15155, 9109, 191, 6346, 14859, 4202, 10175,
+      12626, 8682, 16322, 9938, 4300, 1700, 8459, 2534, 5746, 12404, 1298, 4670,
+      15775, 6217, 2617, 13090, 5566, 4078, 8332, 1903, 13580, 11829, 2407, 15022,
+      6945, 4483, 8618, 11115, 3168, 12893, 1855, 9158, 15323, 10969, 12916, 3204,
+      15269, 10057, 13943, 414, 5594, 14961, 2151, 5021, 12261, 10433, 14022, 9071,
+      12378, 7032, 10680, 7889, 2762, 16293, 424, 11100, 13218, 6944, 12194, 8567,
+      2937, 4994, 824, 10184, 5590, 12955, 2182, 10586, 6875, 2691, 12729, 7495,
+      6102, 3271, 11824, 1064, 8186, 2896, 5238, 1542, 13033, 4492, 8349, 12028,
+      2204, 5532, 7778, 997, 6692, 13172, 8122, 12104, 1705, 10725, 4289, 9240,
+      11212, 6327, 4494, 14032, 7713, 3869, 1627, 11504, 15259, 5688, 12186, 7022,
+      15328, 5985, 670, 8669, 1826, 12556, 2670, 15946, 13135, 5650, 494, 9872,
+      4311, 12520, 7403, 3733, 12761, 2410, 11148, 7493, 14296, 3872, 5519, 13888,
+      6680, 13056, 15824, 10027, 3988, 14456, 6939, 8835, 11914, 3672, 14201, 7084,
+      9336, 553, 12542, 3517, 9480, 5130, 13976, 9083, 10663, 1441, 15621, 7242,
+      14600, 10172, 4568, 13486, 3415, 1280, 7664, 5139, 13387, 1582, 4625, 9248,
+      12633, 6874, 13314, 8002, 3085, 15239, 6654, 2337, 13458, 3809, 15161, 1849,
+      5799, 8350, 4439, 14874, 5690, 10024, 234, 15154, 6379, 9521, 14881, 4007,
+      15771, 7850, 9287, 13880, 4825, 15141, 10106, 370, 11095, 9178, 14864, 5664,
+      13416, 11602, 15099, 9235, 7161, 16229, 1070, 3876, 9449, 12931, 15925, 11644,
+      2985, 14882, 180, 4917, 16323, 6045, 12518, 13998, 1867, 8275, 11617, 2797,
+      12248, 10286, 16267, 6741, 3066, 9686, 14206, 1726, 13020, 2999, 10196, 14455,
+      5043, 11004, 8225, 4279, 11275, 9223, 14445, 12051, 5904, 1159, 10838, 16241,
+      9767, 5354, 15654, 516, 2973, 11603, 1288, 10950, 9057, 829, 5187, 11920,
+      535, 9286, 2861, 13299, 1803, 9747, 11144, 1400, 16154, 11399, 13910, 6954,
+      15842, 809, 6311, 3429, 13154, 5786, 12069, 2287, 5377, 84, 16008, 6545,
+      8453, 12221, 14807, 222, 11164, 6288, 12084, 7712, 3318, 1121, 9863, 16324,
+      5981, 290, 8412, 4407, 10308, 740, 8924, 11947, 14146, 10765, 12713, 1789,
+      3073, 7902, 4573, 10824, 14283, 12049, 8355, 2501, 10944, 460, 3556, 12252,
+      1458, 8427, 5674, 13246, 16182, 4846, 2242, 10080, 4052, 186, 6619, 3396,
+      12267, 5676, 10747, 14876, 7352, 1432, 4583, 8844, 5442, 10013, 7471, 13714,
+      9128, 3108, 1000, 7213, 4953, 16040, 340, 14977, 6263, 1067, 8178, 12834,
+      179, 11240, 3889, 5109, 9429, 7604, 11791, 3656, 7197, 83, 14700, 6739,
+      1656, 3228, 7153, 2300, 15393, 13541, 2891, 6651, 1001, 8637, 13292, 5946,
+      9504, 15104, 8008, 2585, 12495, 3541, 7919, 15049, 6409, 10642, 16294, 5521,
+      7688, 15215, 4786, 8191, 2852, 4466, 5911, 1693, 10283, 8091, 11237, 15180,
+      556, 8805, 3963, 13865, 9624, 7791, 11658, 2426, 10593, 5418, 3730, 9487,
+      8087, 15960, 2626, 14734, 10971, 14098, 4296, 1682, 10646, 13657, 11679, 14605,
+      7548, 15903, 4855, 6682, 3221, 790, 7212, 9282, 11760, 15987, 13511, 1951,
+      3645, 641, 5965, 13723, 12622, 5400, 15488, 6270, 11189, 14395, 4025, 2499,
+      8034, 998, 12664, 7470, 15793, 8614, 10576, 13833, 697, 8503, 2715, 13281,
+      6123, 14226, 10645, 2179, 15536, 12746, 3595, 1961, 6758, 11485, 15280, 10322,
+      13130, 3559, 10065, 8612, 4808, 14347, 3427, 5426, 14746, 7155, 8491, 15954,
+      449, 13851, 2097, 15727, 9307, 13600, 5338, 10078, 15326, 13308, 5133, 10480,
+      7809, 8908, 4816, 14518, 12171, 4155, 2243, 7236, 12446, 4353, 6476, 15590,
+      5392, 14299, 10804, 2352, 4577, 12742, 1478, 3892, 11670, 286, 6324, 12728,
+      14366, 10667, 8771, 14983, 3237, 12889, 2130, 4779, 7575, 15956, 11438, 6492,
+      1563, 13294, 3693, 14437, 848, 15688, 6877, 12818, 1899, 4277, 9940, 760,
+      5009, 8557, 6377, 12823, 8889, 5108, 2716, 1115, 5868, 11192, 1659, 12979,
+      9968, 15802, 5421, 14458, 4019, 1072, 8962, 6993, 10033, 16069, 4468, 7186,
+      1770, 8099, 9896, 2250, 7581, 693, 9214, 12037, 6610, 14585, 10899, 3080,
+      5951, 12328, 2123, 5071, 15700, 11233, 4442, 9708, 133, 3546, 7896, 12007,
+      827, 6069, 11257, 9643, 14287, 4111, 8364, 2558, 5677, 11945, 7042, 1938,
+      11117, 12571, 8913, 10560, 2275, 13289, 1366, 12302, 6650, 10341, 4510, 6156,
+      12440, 1909, 3438, 11963, 907, 8075, 11686, 228, 3810, 11524, 1752, 10228,
+      7676, 13966, 10906, 14865, 1196, 10524, 13678, 356, 9809, 6987, 1135, 8819,
+      14014, 7168, 8596, 14843, 9577, 13510, 3331, 9108, 1879, 7243, 159, 11665,
+      5454, 14572, 6727, 12236, 10345, 1766, 3059, 14821, 10754, 4746, 8898, 6176,
+      9983, 13231, 2500, 10671, 14493, 6060, 13328, 7157, 15714, 12158, 2545, 15131,
+      3596, 7296, 15709, 9648, 12507, 3005, 9210, 14553, 4106, 8488, 2530, 13305,
+      6601, 11297, 5321, 12840, 2432, 11400, 8767, 15071, 10638, 4196, 14497, 13283,
+      4732, 15927, 10692, 14028, 3643, 8855, 5218, 13642, 1256, 14712, 3846, 9776,
+      7388, 1590, 15170, 8063, 12595, 16096, 5355, 13947, 4010, 8537, 15091, 1056,
+      5316, 12391, 274, 14111, 9489, 1167, 13751, 15602, 2855, 7287, 672, 15894,
+      4542, 9735, 5818, 10819, 3144, 14551, 8538, 787, 10756, 7687, 16183, 5895,
+      9573, 4320, 13750, 16059, 6304, 12998, 15632, 5636, 3138, 132, 9001, 5098,
+      3477, 8693, 2420, 11846, 4015, 13233, 15948, 12017, 3466, 400, 11367, 5960,
+      2547, 7311, 15988, 11836, 5311, 15439, 13427, 4091, 9668, 991, 9053, 3709,
+      14354, 6130, 9473, 8077, 526, 15776, 11994, 1829, 7724, 4471, 8723, 5191,
+      1146, 11919, 8874, 3574, 10387, 1510, 7760, 11446, 527, 10821, 13144, 4096,
+      8259, 13791, 5493, 7329, 1293, 12400, 10611, 433, 9842, 2862, 15544, 7970,
+      14640, 6385, 1103, 3261, 12039, 248, 8896, 2994, 11653, 6408, 2072, 5462,
+      197, 15646, 1934, 9591, 7838, 11146, 6549, 14246, 12826, 5846, 11865, 2083,
+      6673, 10327, 2510, 9404, 6968, 13148, 2467, 7680, 16023, 10145, 6318, 7725,
+      15809, 4675, 6174, 9006, 4328, 13258, 5777, 11854, 7763, 14999, 3783, 13586,
+      1806, 5334, 11876, 15332, 3905, 13276, 8886, 2574, 14836, 6960, 1706, 9163,
+      2868, 7466, 1049, 9416, 14725, 11964, 6389, 15381, 12920, 7539, 16117, 6314,
+      9255, 2674, 4954, 6033, 10182, 15690, 4871, 14306, 1249, 10758, 4376, 707,
+      9998, 3096, 6382, 8031, 16236, 2636, 13345, 7777, 283, 12968, 4136, 12354,
+      5473, 7341, 2804, 13618, 15050, 277, 11241, 16295, 7829, 2796, 15322, 82,
+      5785, 13123, 3992, 9311, 14320, 5992, 1359, 6802, 2000, 16153, 411, 11810,
+      15277, 6264, 4805, 15092, 7590, 12428, 4538, 104, 5246, 13307, 9501, 13989,
+      5875, 16296, 6743, 12740, 941, 10164, 8353, 13455, 7414, 10336, 11812, 4420,
+      16297, 349, 8892, 2879, 1042, 9306, 3653, 14511, 4875, 1141, 11641, 15389,
+      307, 10783, 4535, 11709, 3441, 1546, 13274, 3822, 1983, 11490, 12603, 204,
+      10732, 14412, 1592, 10149, 2936, 820, 8773, 6922, 16377, 7703, 9797, 2758,
+      7056, 4968, 293, 11194, 12646, 3544, 10666, 5308, 13929, 10991, 4588, 12751,
+      6947, 3914, 2137, 9855, 863, 11339, 4911, 1424, 15009, 7666, 11078, 1835,
+      7842, 12793, 2913, 9887, 8171, 12579, 6093, 14609, 8400, 12799, 2029, 10507,
+      12309, 5781, 11217, 15510, 5235, 11024, 16165, 2399, 14248, 9611, 4291, 10444,
+      5763, 12293, 3625, 13579, 6207, 9684, 4813, 11278, 14565, 6979, 16174, 5420,
+      2386, 8406, 15434, 11949, 9956, 4556, 10799, 3308, 8246, 2091, 13876, 3183,
+      9082, 1658, 13699, 10436, 2793, 12193, 4263, 7933, 2212, 10297, 4970, 7775,
+      14900, 3399, 15452, 4258, 12609, 3016, 6169, 13163, 2578, 5672, 15109, 11545,
+      4752, 13623, 7289, 10914, 9043, 13721, 8085, 3210, 5648, 14855, 8733, 13512,
+      5711, 9152, 11326, 14678, 10358, 8020, 3355, 15173, 6857, 8362, 3735, 15333,
+      6274, 14192, 11182, 12406, 203, 3985, 13155, 1503, 14231, 10402, 15081, 6191,
+      1486, 14190, 7751, 12321, 784, 14947, 8539, 1857, 10391, 16298, 8140, 13866,
+      5841, 2867, 14428, 10244, 13022, 60, 12497, 15409, 9197, 945, 6754, 13641,
+      3920, 15379, 2195, 7422, 10847, 4738, 14397, 450, 3928, 7364, 1223, 3270,
+      9203, 1466, 8312, 6930, 903, 11503, 15437, 1317, 9002, 7097, 2211, 10152,
+      969, 12606, 14087, 8228, 2206, 9758, 925, 11804, 13551, 10256, 4866, 3089,
+      14779, 8071, 5872, 13591, 9565, 11154, 6940, 12100, 5602, 15361, 6553, 8675,
+      15936, 7109, 1585, 15229, 11296, 3706, 13915, 1916, 9440, 5948, 11576, 1164,
+      8800, 14426, 830, 7222, 9233, 12231, 3744, 7795, 9997, 16112, 2548, 387,
+      14993, 3901, 6333, 12904, 9802, 2041, 6703, 897, 15489, 7357, 2681, 4940,
+      6660, 971, 13990, 9755, 2343, 5068, 12324, 8979, 13173, 4484, 2400, 5062,
+      10274, 15139, 8859, 6089, 12136, 8210, 3412, 7519, 9751, 4830, 15411, 2387,
+      9925, 6276, 3001, 13494, 5486, 561, 11064, 4344, 12299, 9372, 6953, 3738,
+      8287, 4696, 6483, 3142, 4365, 14623, 10920, 5597, 24, 9167, 11431, 3588,
+      914, 15967, 6726, 9232, 13550, 15245, 10189, 14050, 6431, 14962, 10422, 3858,
+      13412, 6041, 7932, 3380, 12969, 15739, 4679, 14473, 7555, 3811, 1562, 6352,
+      4336, 12792, 3156, 7905, 4128, 207, 13974, 7342, 981, 13088, 2383, 15436,
+      4372, 1614, 16268, 550, 10222, 3853, 11676, 832, 3615, 11075, 9783, 6243,
+      12813, 912, 8394, 11894, 4524, 13575, 2436, 6762, 10117, 4949, 15423, 11052,
+      13814, 1474, 6707, 13222, 735, 6157, 12219, 5496, 7697, 12383, 1501, 16269,
+      4391, 12081, 14364, 3170, 10214, 12669, 428, 16232, 9016, 12996, 4218, 5971,
+      11377, 16147, 467, 7023, 1845, 10051, 7819, 14627, 6470, 2649, 11540, 4417,
+      770, 15651, 2196, 13301, 11820, 502, 8680, 3885, 7255, 16005, 4352, 11723,
+      9315, 14448, 3272, 7301, 15819, 655, 13479, 1812, 11803, 14673, 9534, 13766,
+      7294, 12012, 2214, 16242, 7773, 13219, 5137, 14118, 12210, 8806, 2993, 11133,
+      5141, 2177, 8470, 4511, 12722, 2599, 5077, 12032, 8743, 2520, 14122, 5324,
+      10753, 706, 8345, 11288, 5665, 15463, 10455, 12055, 8796, 15652, 10647, 15021,
+      6596, 11606, 9094, 5346, 11323, 9700, 6786, 59, 7633, 12764, 5111, 7931,
+      13797, 2176, 7513, 13016, 5637, 14351, 258, 4509, 9036, 14606, 6901, 15782,
+      58, 10506, 8047, 16200, 12243, 2266, 8176, 3258, 4718, 15828, 10595, 2308,
+      14385, 8307, 3576, 15495, 9939, 2743, 10982, 8784, 714, 7694, 10634, 5254,
+      8132, 4283, 13875, 5760, 11832, 2030, 15388, 8677, 1506, 13481, 10365, 3383,
+      11642, 15929, 721, 8963, 13410, 1195, 7934, 13744, 10099, 5369, 9088, 4280,
+      15950, 5806, 10582, 13189, 11557, 261, 14011, 7565, 1426, 6666, 12570, 1904,
+      8699, 5347, 10617, 15534, 5926, 2643, 788, 10544, 1338, 5288, 8595, 10242,
+      3257, 1411, 9726, 6872, 1930, 5599, 13775, 1284, 12629, 6943, 12099, 23,
+      10776, 7570, 13950, 533, 15591, 11059, 1153, 9251, 14936, 6460, 3071, 12787,
+      252, 9123, 2840, 14375, 741, 7096, 5269, 1328, 13031, 2742, 16116, 1864,
+      14236, 4034, 12013, 8866, 14713, 10408, 3483, 9296, 11386, 4611, 14652, 9068,
+      2371, 8111, 12103, 15834, 2273, 5481, 2895, 9655, 6184, 14765, 3268, 5430,
+      732, 13498, 6412, 10040, 103, 8820, 5549, 11973, 4415, 9527, 11456, 1244,
+      13204, 4812, 7176, 14169, 5964, 13409, 2402, 15192, 11911, 1921, 9508, 7133,
+      3282, 10710, 7528, 12367, 3570, 5407, 7716, 14398, 4730, 6065, 12617, 3353,
+      10543, 5653, 16108, 3226, 6641, 14603, 11295, 1350, 7020, 3048, 14579, 1739,
+      5022, 8747, 10493, 2525, 15689, 4683, 9827, 15037, 11223, 2769, 7644, 3981,
+      8972, 11357, 16050, 8000, 12953, 15200, 4046, 13593, 6036, 11978, 15801, 4135,
+      15108, 10168, 7706, 4011, 15843, 9890, 3580, 6099, 15958, 1689, 9451, 5771,
+      3290, 6850, 12639, 4064, 2152, 11975, 9817, 16094, 4209, 13389, 7733, 5761,
+      3877, 13761, 2431, 10028, 8339, 4410, 10335, 7942, 6144, 2957, 15934, 5271,
+      2654, 6383, 14113, 930, 15636, 6135, 1210, 10573, 4943, 13617, 3395, 7293,
+      10519, 13513, 12179, 4001, 11285, 1481, 12876, 9275, 10947, 3933, 15038, 11553,
+      14188, 7525, 3120, 15270, 7300, 1695, 14655, 6589, 8933, 146, 15728, 3155,
+      11671, 4116, 9406, 238, 6402, 15753, 11060, 1151, 14273, 4781, 7, 6394,
+      14777, 9211, 1230, 12424, 9707, 2576, 7424, 15415, 4329, 12284, 9258, 2001,
+      12849, 517, 7784, 13532, 9908, 12224, 8206, 6361, 15596, 3365, 12854, 5732,
+      8430, 13332, 131, 6027, 4189, 14574, 12094, 496, 14076, 6988, 4724, 3081,
+      6203, 1910, 11384, 474, 14550, 7647, 2634, 8387, 11281, 199, 14688, 5835,
+      8316, 1015, 14829, 13241, 8846, 4154, 12912, 15068, 8029, 10022, 16243, 5993,
+      13634, 7489, 5048, 1708, 6910, 10997, 1997, 15765, 11428, 8992, 12471, 14830,
+      6186, 13644, 493, 14974, 12582, 10619, 1007, 13695, 11444, 1771, 12132, 7169,
+      3007, 8477, 12343, 16143, 633, 9687, 5910, 11689, 1367, 7834, 781, 14081,
+      8617, 7260, 4497, 14349, 6885, 8569, 1212, 4890, 2145, 12544, 9388, 587,
+      13438, 10921, 5294, 3371, 13924, 12077, 5424, 9558, 1513, 15015, 6989, 12519,
+      3031, 8365, 4075, 12917, 7954, 15807, 9629, 13635, 11156, 2513, 15498, 6729,
+      301, 14892, 11287, 1588, 8384, 57, 14730, 7370, 10696, 5031, 3480, 14972,
+      2417, 4877, 849, 13674, 10102, 7043, 918, 15102, 10854, 3454, 11672, 8015,
+      13654, 1301, 9923, 5638, 12735, 1791, 10200, 13708, 11957, 8235, 9605, 6861,
+      4726, 10788, 946, 13288, 5270, 3325, 11776, 13124, 2615, 11070, 5120, 2390,
+      7172, 11425, 2773, 10486, 1534, 4698, 177, 8405, 10588, 802, 14590, 8861,
+      14046, 5305, 12568, 9551, 423, 7559, 4760, 1090, 3484, 11739, 7233, 4969,
+      1593, 8449, 6738, 9384, 4487, 8089, 14926, 5299, 13109, 9869, 3957, 6956,
+      13007, 14867, 1941, 15398, 4539, 10043, 16142, 5164, 2071, 15163, 11572, 335,
+      2713, 15885, 12278, 9662, 6039, 16325, 4122, 10362, 6440, 2641, 16070, 8033,
+      10518, 2012, 7629, 13639, 10844, 8177, 5052, 13884, 9846, 5565, 14759, 2586,
+      10264, 5709, 3099, 1404, 4544, 8086, 10577, 3939, 13463, 8513, 4818, 14142,
+      6503, 10913, 5340, 3821, 15827, 9560, 12569, 6054, 8759, 16299, 11033, 4063,
+      2345, 12082, 9405, 4432, 1514, 6775, 15783, 2158, 9265, 6865, 16189, 8395,
+      3550, 15448, 8748, 172, 3891, 15921, 2584, 12791, 15588, 3590, 9309, 14410,
+      6819, 9788, 1647, 8888, 6634, 13861, 9411, 11931, 1235, 14601, 6603, 5188,
+      12188, 14406, 11302, 2604, 15085, 3898, 12433, 2927, 10424, 1251, 3487, 14955,
+      6261, 2655, 16039, 9216, 10653, 15368, 2851, 9780, 14156, 3826, 15356, 12814,
+      580, 10092, 2755, 10825, 170, 15138, 2149, 11319, 8168, 3011, 9000, 6721,
+      13859, 3058, 6249, 9299, 12473, 3106, 5833, 10186, 13064, 5478, 7637, 3003,
+      13589, 7080, 1578, 14923, 4765, 8891, 12366, 1504, 4612, 15445, 2951, 6284,
+      544, 3510, 15628, 1683, 11376, 892, 12240, 6844, 579, 11756, 8551, 12699,
+      16270, 5790, 12109, 2056, 9545, 6246, 2920, 9860, 12863, 2263, 13908, 11856,
+      1040, 8124, 1936, 10853, 130, 6859, 13068, 9012, 14935, 5608, 14361, 7826,
+      13752, 9665, 12760, 5477, 3322, 12989, 4767, 2425, 10793, 6635, 5012, 14228,
+      7248, 10465, 5724, 771, 7963, 11712, 5920, 2160, 12256, 16163, 4932, 15062,
+      3791, 705, 7738, 16300, 4438, 8626, 382, 13386, 9064, 3457, 7223, 12943,
+      5258, 9875, 7870, 5903, 15887, 7265, 8548, 4564, 10767, 13489, 12001, 5318,
+      6697, 1929, 8366, 12389, 6018, 11397, 2018, 5606, 14337, 6617, 16326, 8327,
+      4754, 7407, 14063, 5768, 10870, 4171, 12500, 304, 11417, 8092, 13036, 499,
+      10786, 7475, 15635, 8836, 3894, 1635, 14495, 10697, 315, 11732, 8439, 11195,
+      13272, 966, 14355, 7149, 11860, 8702, 10107, 14761, 11570, 12977, 8955, 4562,
+      7194, 16118, 9066, 4801, 13694, 14970, 4213, 10067, 7069, 503, 13771, 4999,
+      15623, 12524, 813, 16233, 4027, 7240, 8901, 2982, 6253, 13471, 4534, 15460,
+      14043, 3448, 5174, 1613, 7563, 371, 3317, 11110, 2362, 4806, 559, 11443,
+      10273, 15076, 278, 11785, 14367, 1039, 12547, 11134, 1447, 14795, 4401, 13898,
+      9929, 1491, 14879, 4281, 8424, 466, 7488, 10054, 12506, 14513, 2843, 6002,
+      12842, 10688, 15387, 7574, 2120, 15945, 5939, 9333, 1113, 15650, 1989, 11864,
+      13, 13402, 11331, 14346, 1179, 8134, 3682, 151, 14558, 13223, 4545, 16327,
+      295, 7811, 9131, 3037, 11684, 4044, 1268, 13361, 11502, 3300, 9522, 884,
+      16036, 7657, 14552, 10178, 5278, 2186, 15106, 4013, 14217, 4773, 1051, 13542,
+      6718, 11906, 8338, 4590, 15399, 3445, 5528, 2162, 7651, 3752, 10011, 5373,
+      584, 14066, 4207, 1643, 5290, 6829, 2544, 10736, 13333, 3426, 2116, 10504,
+      7509, 1567, 6312, 2320, 14475, 3275, 9026, 7401, 1351, 10881, 7766, 5720,
+      11348, 617, 15484, 9917, 14453, 11476, 7325, 2810, 9868, 7986, 12395, 10288,
+      15745, 11575, 13185, 6185, 16244, 8789, 14100, 6582, 1853, 8104, 6005, 9494,
+      7303, 4210, 9179, 6016, 3284, 8982, 12154, 6432, 2966, 12921, 7308, 10683,
+      13840, 3479, 11353, 1986, 6273, 4834, 10929, 9653, 1662, 3235, 5752, 4184,
+      10925, 627, 14053, 4024, 11499, 6756, 14154, 4669, 9124, 3141, 5595, 2288,
+      9649, 6822, 15476, 10004, 11341, 7591, 1202, 10503, 3512, 13629, 15712, 10415,
+      7253, 12677, 9164, 5931, 1799, 15520, 12287, 5147, 13112, 1172, 6076, 2802,
+      15896, 9112, 6809, 10111, 1990, 8404, 11025, 2466, 14890, 9765, 900, 6397,
+      9183, 12476, 14517, 9729, 15508, 6172, 11291, 15922, 3381, 6593, 12503, 8105,
+      16341, 9595, 14526, 129, 8293, 6268, 14629, 12407, 3626, 15920, 11251, 13065,
+      8215, 10713, 15193, 11809, 4195, 13945, 3208, 14654, 8628, 13302, 2048, 5480,
+      3966, 514, 9261, 5730, 11899, 999, 13764, 2768, 6517, 4526, 8310, 1181,
+      10551, 3530, 7535, 15282, 3833, 12228, 14645, 3045, 12861, 15199, 2546, 16301,
+      13238, 7609, 1954, 15066, 8550, 4986, 15868, 964, 9594, 5871, 12975, 15773,
+      8708, 12068, 128, 15567, 8144, 14136, 9529, 13652, 12266, 8401, 10299, 2240,
+      13559, 8619, 3549, 10668, 15312, 6974, 12417, 16245, 4312, 12922, 5625, 2104,
+      3246, 5792, 9168, 11985, 5383, 6747, 1581, 4838, 492, 15273, 2837, 14088,
+      10351, 6514, 8466, 2464, 6846, 9603, 11782, 4499, 12937, 1361, 12034, 5547,
+      12886, 16271, 6105, 12447, 5224, 3542, 16019, 13452, 2427, 7508, 1382, 4375,
+      11909, 56, 2551, 8566, 12907, 9706, 2268, 11054, 744, 3850, 12191, 5210,
+      15424, 11556, 978, 5666, 9660, 8451, 406, 5359, 3977, 1130, 5912, 2205,
+      6668, 9133, 10426, 1610, 4449, 6490, 12119, 8027, 10827, 16190, 12811, 1786,
+      14709, 4163, 5869, 8916, 14452, 1896, 9934, 14844, 5144, 12018, 1006, 13071,
+      5436, 9103, 821, 4828, 10508, 1671, 8119, 10131, 622, 11390, 4067, 10572,
+      2, 11583, 3694, 6648, 2208, 15133, 4475, 1246, 3259, 7349, 13251, 4151,
+      6833, 11645, 1098, 2538, 6528, 4952, 15469, 7599, 5603, 453, 12859, 6183,
+      1557, 10068, 625, 8408, 10702, 1054, 14450, 8729, 12481, 13886, 15205, 2566,
+      13119, 10109, 14717, 12184, 8297, 10871, 5244, 7987, 4250, 284, 14464, 3911,
+      15000, 1991, 13853, 8474, 7159, 3529, 14767, 823, 7672, 2943, 9488, 102,
+      7432, 10761, 1828, 11461, 5428, 10301, 13081, 6955, 8860, 13442, 14901, 7076,
+      1322, 15260, 4749, 13972, 6077, 13461, 7408, 1653, 9208, 4187, 7798, 13262,
+      1960, 14037, 6782, 15386, 12124, 14152, 9745, 13043, 16064, 473, 5533, 12456,
+      15844, 10147, 3150, 15031, 1341, 6907, 3635, 8495, 10532, 7208, 16095, 232,
+      10945, 12759, 3750, 7091, 13417, 2516, 9417, 10779, 2329, 16119, 11261, 7054,
+      14019, 5885, 12146, 3817, 5494, 14547, 6902, 15640, 5829, 9190, 14278, 12752,
+      11000, 8532, 7117, 10497, 14109, 9312, 2385, 14862, 5450, 3023, 15989, 8003,
+      14740, 921, 3279, 11921, 9752, 15897, 2822, 11566, 8130, 14944, 5060, 13983,
+      3375, 7556, 11513, 4599, 7019, 1324, 4297, 7358, 640, 8615, 3859, 2327,
+      6336, 13275, 1077, 15912, 11561, 12898, 9313, 10974, 7909, 5461, 10360, 165,
+      14235, 10989, 9667, 4379, 11423, 14078, 4102, 15275, 8658, 12986, 4443, 7971,
+      15217, 3741, 812, 16328, 3072, 5107, 10500, 3870, 5814, 11455, 7507, 3083,
+      8712, 10419, 2509, 11028, 12957, 2929, 10096, 15744, 5018, 3287, 10439, 8863,
+      2629, 7625, 4925, 3243, 8341, 11408, 14250, 2724, 7955, 55, 13967, 4792,
+      9734, 13596, 5391, 15204, 2552, 12948, 9703, 3531, 7526, 5507, 15904, 523,
+      8673, 6087, 15641, 4662, 8244, 6335, 13147, 2672, 8711, 145, 14950, 7442,
+      13676, 1200, 9725, 2609, 12380, 1701, 7504, 2924, 5131, 14539, 299, 12161,
+      6044, 4645, 10340, 1005, 11229, 9264, 12482, 4234, 10729, 13267, 6895, 14297,
+      1749, 5045, 9030, 14411, 4118, 2374, 12140, 6544, 1722, 15566, 9621, 389,
+      16074, 10851, 8935, 11505, 15883, 5166, 13830, 9552, 14982, 3630, 9994, 2299,
+      7291, 3093, 5178, 924, 11976, 2624, 15681, 4164, 6142, 2248, 8051, 15790,
+      6495, 1606, 10471, 13553, 2662, 5934, 14626, 380, 9360, 13822, 10917, 6000,
+      11708, 1515, 7861, 12355, 14434, 396, 9535, 15947, 1117, 14625, 5543, 15833,
+      6629, 14276, 327, 6465, 11171, 12784, 1375, 4616, 11418, 28, 15238, 12316,
+      1232, 7279, 4342, 9602, 5837, 11585, 7156, 8815, 2676, 11936, 318, 11243,
+      6566, 1214, 5004, 13961, 11478, 2438, 9302, 11633, 14729, 3367, 12614, 635,
+      13939, 1551, 4101, 9979, 15835, 4596, 11094, 2893, 8667, 12587, 4950, 8096,
+      14005, 4423, 16272, 10087, 1479, 11594, 3896, 15935, 1646, 15185, 12976, 8436,
+      14008, 7141, 431, 6038, 9497, 2143, 8700, 4389, 11128, 13735, 7083, 808,
+      5839, 13265, 9181, 10852, 4004, 11984, 5379, 3013, 12777, 6094, 3219, 14105,
+      1985, 6608, 11135, 154, 7699, 5511, 12108, 8592, 14778, 6360, 13296, 16367,
+      3725, 6667, 12590, 9222, 11525, 14939, 5343, 436, 13244, 8298, 5126, 6932,
+      1275, 12102, 10060, 2848, 6880, 4944, 1948, 7723, 14766, 9557, 13796, 2312,
+      8668, 3533, 13058, 6364, 12114, 4440, 8057, 688, 8757, 4843, 12339, 2476,
+      8304, 14478, 7286, 16302, 13399, 6552, 8967, 10531, 5966, 15089, 1756, 12636,
+      15353, 3971, 2034, 12795, 5998, 14531, 7990, 4460, 9201, 11861, 15511, 8368,
+      763, 13035, 6684, 4811, 1817, 7765, 11035, 6724, 10224, 14973, 12054, 7670,
+      1299, 12674, 9345, 6499, 1784, 15823, 3311, 11452, 506, 10705, 5918, 8716,
+      13047, 6551, 8093, 9589, 2933, 7806, 6442, 3797, 2118, 4892, 15176, 12994,
+      3492, 11604, 16303, 81, 6357, 3172, 12662, 10598, 16136, 7378, 101, 15023,
+      8616, 13574, 7187, 14770, 8278, 1654, 10037, 4820, 12414, 8389, 3139, 12732,
+      16246, 1363, 14017, 4702, 451, 10457, 1586, 8976, 11089, 14602, 723, 7518,
+      1439, 13107, 3029, 11872, 9367, 3453, 15582, 11203, 9008, 16186, 4790, 13464,
+      11905, 15761, 8752, 12725, 4094, 291, 6597, 4772, 15750, 10726, 5197, 1821,
+      10219, 2955, 14023, 11704, 3657, 10521, 15124, 9391, 3962, 762, 5778, 9541,
+      1753, 4031, 13982, 2087, 3560, 13598, 10864, 8375, 834, 14094, 10421, 15821,
+      1406, 9977, 3124, 16015, 13392, 2109, 3384, 6126, 10280, 15290, 3189, 13524,
+      9920, 14114, 4038, 2370, 8823, 5396, 3022, 6059, 14319, 2468, 5363, 15162,
+      11778, 9894, 5639, 14641, 6757, 13261, 3572, 902, 14929, 2260, 13756, 5561,
+      12583, 10794, 767, 11837, 16169, 10279, 7856, 1666, 14514, 5016, 7462, 10227,
+      15304, 8429, 1302, 9304, 3581, 11735, 4881, 2835, 6058, 950, 2227, 10651,
+      4446, 13291, 15087, 7402, 1031, 15265, 9967, 4422, 6295, 9335, 10994, 3374,
+      12358, 15378, 7610, 4895, 1718, 9911, 5323, 15478, 3769, 8217, 10252, 6068,
+      14368, 2136, 12554, 292, 3903, 6339, 1790, 8044, 3696, 610, 10411, 2472,
+      5684, 15557, 9962, 11940, 970, 7299, 13690, 8437, 15252, 6973, 9300, 1569,
+      13398, 5963, 1221, 7008, 15779, 10296, 12359, 3378, 11029, 8249, 5267, 15693,
+      9383, 7690, 4660, 2661, 6760, 9256, 5329, 7658, 4299, 11414, 6742, 709,
+      5444, 10592, 7386, 14733, 4548, 1453, 8154, 11186, 80, 5826, 16247, 11801,
+      13295, 384, 15724, 11587, 8402, 10721, 13336, 418, 4037, 7297, 1025, 8870,
+      2100, 9492, 15491, 7572, 10958, 4465, 10317, 524, 14860, 4907, 14185, 9435,
+      6148, 3070, 12035, 9023, 6554, 836, 13837, 2736, 11796, 4560, 14799, 5572,
+      2157, 15255, 8226, 12692, 10479, 15705, 9397, 12192, 6560, 205, 8725, 11721,
+      2723, 5371, 13254, 1709, 11877, 2430, 7436, 14561, 5907, 9628, 3197, 14135,
+      12681, 8320, 2449, 13732, 10707, 4741, 16342, 1046, 7374, 4531, 10090, 7938,
+      14802, 11772, 9709, 14401, 11340, 6275, 13171, 7237, 14182, 10954, 2719, 7920,
+      14692, 2433, 3874, 11624, 168, 12867, 5378, 16106, 7685, 2554, 14082, 11361,
+      5256, 13363, 2223, 7562, 14499, 12724, 949, 11577, 6329, 253, 11918, 16090,
+      13491, 3419, 12280, 444, 13169, 14741, 8857, 12185, 8106, 14027, 940, 12775,
+      9682, 11944, 5297, 15691, 7210, 9496, 1358, 7835, 4601, 7063, 9484, 4249,
+      1003, 6755, 3385, 8139, 14203, 10460, 12789, 16024, 4493, 12118, 5389, 2838,
+      12477, 6150, 16132, 3701, 8540, 7211, 1470, 4153, 13530, 181, 14924, 4045,
+      10957, 12719, 9325, 5767, 1655, 7557, 13515, 11137, 6811, 9889, 1394, 13873,
+      7500, 3435, 4951, 14479, 2953, 16343, 3768, 5952, 14327, 9044, 6905, 15630,
+      8094, 13533, 5102, 761, 8415, 2009, 11900, 6807, 15952, 3648, 6159, 11612,
+      6959, 1730, 9021, 13193, 11427, 15063, 5947, 13747, 2977, 7218, 872, 5535,
+      2671, 15083, 9205, 3856, 772, 8604, 4248, 12736, 5613, 9126, 16033, 6562,
+      4853, 2322, 10834, 3832, 10143, 12312, 8507, 3404, 169, 8202, 4655, 15298,
+      1462, 6713, 9779, 3063, 13320, 14693, 9826, 5881, 10657, 1798, 15028, 8411,
+      2866, 5726, 1652, 3743, 15309, 4659, 9065, 2508, 3664, 6854, 14356, 2365,
+      4130, 12830, 3055, 15086, 10559, 14034, 2207, 12738, 14491, 9963, 16304, 12160,
+      4930, 2291, 6165, 3167, 7910, 10613, 417, 14348, 8329, 1128, 9310, 11858,
+      2198, 12436, 15515, 8814, 10904, 7550, 5423, 2381, 15938, 7991, 3326, 15169,
+      12872, 9828, 3851, 1088, 12539, 14418, 3970, 5409, 462, 11407, 8379, 1069,
+      7331, 10978, 13045, 10160, 803, 11333, 3489, 298, 10052, 3841, 14964, 10604,
+      12905, 15603, 5542, 6, 10438, 13306, 9101, 611, 15292, 12562, 2815, 5628,
+      3700, 717, 9219, 1625, 5047, 13290, 15930, 10896, 8281, 4712, 1621, 16344,
+      11789, 13581, 6452, 1198, 14036, 11051, 816, 9922, 15005, 8755, 14256, 6709,
+      471, 4770, 14832, 6573, 9825, 13996, 11873, 6053, 10485, 4362, 16129, 7515,
+      5006, 2258, 4043, 1089, 7567, 5034, 11151, 6523, 16345, 9424, 10861, 12940,
+      2384, 6359, 11669, 16230, 8230, 13446, 665, 10356, 8591, 14559, 11369, 5476,
+      1057, 3691, 11216, 7900, 5081, 2522, 5945, 1291, 9316, 15347, 11373, 13900,
+      1381, 15146, 6776, 9961, 13203, 3153, 6999, 14130, 5890, 10035, 2907, 6506,
+      1813, 12213, 13936, 9958, 6231, 1323, 4849, 10807, 6580, 364, 16101, 8698,
+      2881, 6115, 9188, 12072, 15984, 6319, 14060, 12364, 9199, 5339, 1463, 7505,
+      15786, 4888, 12671, 14245, 5716, 11543, 1559, 6420, 2684, 4003, 11307, 7832,
+      4701, 2042, 14589, 5192, 3494, 9892, 7960, 14086, 10298, 7582, 15703, 10771,
+      12222, 8919, 3975, 2129, 14115, 12145, 9772, 5860, 7739, 2155, 15717, 9596,
+      3050, 4516, 7865, 13140, 3447, 11863, 1240, 12741, 15610, 9375, 1724, 11662,
+      16192, 2701, 1055, 8879, 2900, 13697, 487, 11021, 9116, 12345, 8183, 15382,
+      13029, 9017, 3812, 12131, 1540, 4756, 14237, 7121, 9840, 12, 13626, 5170,
+      1273, 11015, 5844, 12396, 4900, 1493, 6469, 9876, 8717, 16041, 6539, 79,
+      15143, 8760, 13465, 10805, 7708, 226, 7070, 4709, 9089, 12449, 3888, 1999,
+      4997, 15044, 10996, 4340, 271, 14957, 4795, 13111, 16031, 4430, 8587, 660,
+      11584, 14224, 12419, 2027, 9046, 13834, 5240, 7409, 10695, 15372, 2095, 7888,
+      2922, 9681, 1679, 3782, 15497, 2428, 13836, 4030, 8467, 2045, 9394, 7205,
+      2898, 8721, 16184, 7668, 9816, 14424, 8848, 1401, 6624, 11831, 7661, 10643,
+      13955, 6302, 144, 15964, 1973, 12730, 4239, 2776, 6471, 624, 10394, 5825,
+      7344, 244, 13423, 3169, 10556, 5086, 11301, 7485, 12416, 6362, 14371, 1720,
+      5723, 7523, 2700, 8357, 5996, 3173, 13282, 5734, 4175, 7459, 10797, 15599,
+      12162, 8156, 5580, 14183, 1345, 14891, 6132, 11322, 2673, 14106, 264, 9882,
+      13228, 7945, 754, 4070, 15799, 11270, 7602, 10221, 4121, 15360, 9010, 3247,
+      15982, 8078, 13612, 2480, 12253, 4734, 12984, 10071, 3459, 11997, 1874, 4315,
+      14676, 3320, 10005, 13003, 2729, 5921, 11310, 16054, 7506, 9526, 1480, 12880,
+      8694, 11433, 7649, 1183, 10287, 3118, 6941, 15355, 3798, 8809, 7313, 15808,
+      4293, 2592, 11559, 14310, 4434, 14, 13408, 10897, 14853, 4600, 13213, 5832,
+      11260, 6864, 9569, 11766, 14469, 6305, 10800, 15501, 1362, 12401, 4543, 13441,
+      464, 5208, 12559, 14990, 9657, 16201, 2968, 1162, 8523, 11922, 4708, 11031,
+      6778, 5309, 8549, 13615, 14840, 8107, 12771, 15227, 11420, 4382, 15048, 8662,
+      1344, 14774, 3873, 54, 15145, 2296, 11404, 8629, 10764, 16248, 4990, 10261,
+      14074, 10889, 7714, 656, 9271, 12765, 5393, 3820, 6949, 1869, 12686, 3879,
+      6869, 3105, 9680, 716, 4678, 7120, 15664, 6084, 3196, 15150, 11768, 5611,
+      8713, 3386, 1912, 14904, 6791, 2610, 12853, 7175, 223, 11753, 3799, 14787,
+      623, 8118, 2725, 14072, 5382, 7305, 15909, 6348, 13158, 11730, 5529, 15850,
+      839, 14251, 8514, 22, 12349, 5783, 2800, 15846, 6759, 3440, 14059, 8906,
+      5695, 11767, 12991, 2169, 5201, 10371, 776, 5782, 13255, 10215, 6823, 1712,
+      12615, 9995, 5295, 6663, 1265, 7445, 10482, 8295, 150, 14819, 4748, 1123,
+      3166, 12933, 601, 4316, 13850, 6167, 10520, 3036, 11635, 7031, 2289, 3753,
+      289, 5380, 12987, 4321, 15614, 2166, 13152, 3102, 9433, 15256, 435, 11161,
+      1917, 5279, 3463, 1180, 9224, 2708, 6080, 11773, 12827, 6908, 13508, 8512,
+      10132, 5196, 15742, 412, 3960, 13620, 12301, 574, 4313, 1928, 14624, 11492,
+      15380, 2103, 13672, 255, 14704, 10234, 9038, 15716, 10755, 13474, 5261, 16160,
+      10449, 12304, 8621, 2154, 10812, 6625, 9362, 2502, 12649, 13988, 6073, 12026,
+      8583, 14096, 1676, 9989, 14948, 5213, 10789, 7418, 5957, 15553, 11711, 1552,
+      8925, 11098, 486, 8356, 2453, 8858, 1558, 7882, 10717, 7025, 4488, 10206,
+      3583, 14711, 7994, 10594, 5094, 701, 12399, 2647, 14643, 320, 9580, 7961,
+      13500, 14723, 3006, 11432, 7969, 511, 15704, 3562, 8899, 7628, 16346, 3808,
+      12512, 14155, 2543, 16016, 3444, 12704, 7886, 10563, 16218, 5415, 8322, 11862,
+      7395, 9448, 982, 14162, 8473, 15642, 10648, 13611, 11615, 9245, 6994, 11123,
+      5813, 9207, 7052, 14179, 1310, 12269, 3774, 9640, 7204, 16223, 10163, 13907,
+      6711, 15848, 8098, 575, 4674, 9458, 1993, 6095, 3294, 12938, 7310, 9581,
+      6456, 2126, 9111, 7065, 15518, 8585, 4975, 6646, 3579, 7857, 9782, 6074,
+      11381, 2942, 4919, 592, 7762, 1560, 8791, 12952, 3644, 1457, 5374, 14871,
+      4317, 13577, 1443, 15485, 7347, 463, 9586, 3918, 859, 5523, 11318, 3501,
+      6367, 9180, 1175, 13318, 10128, 3411, 9438, 6725, 15348, 3982, 14281, 5061,
+      10652, 15440, 4112, 13828, 3147, 12655, 14986, 2282, 13655, 11124, 1033, 13358,
+      9474, 15095, 6392, 10517, 7499, 3946, 15633, 5958, 1154, 11982, 6677, 15201,
+      3940, 9293, 12164, 5906, 14735, 959, 2591, 11293, 9410, 613, 5199, 11828,
+      9976, 6032, 2172, 13516, 6764, 9722, 2730, 15271, 1836, 3703, 15839, 5563,
+      3998, 1383, 6103, 7912, 2806, 15289, 1729, 13691, 478, 15007, 3893, 10495,
+      5737, 7770, 14372, 6079, 13368, 2542, 8441, 4819, 10872, 1859, 9864, 14129,
+      3348, 15980, 10863, 14958, 11783, 1030, 4554, 13849, 11740, 15039, 3573, 11266,
+      13105, 2892, 12504, 10333, 1286, 14275, 12322, 4098, 16249, 7943, 14212, 6350,
+      12148, 14963, 2415, 6537, 7949, 13727, 9486, 11716, 566, 8076, 12195, 3734,
+      10743, 4972, 16166, 13053, 10472, 15412, 7431, 13788, 12594, 2395, 16368, 4629,
+      1918, 14316, 5090, 736, 13162, 2640, 9502, 12804, 976, 6898, 12076, 9512,
+      6410, 1340, 5474, 8724, 7252, 4836, 6600, 2485, 4170, 11394, 1943, 16273,
+      5028, 13743, 11279, 3305, 9034, 4630, 9796, 1517, 13772, 5193, 1886, 13476,
+      11046, 4692, 13178, 8066, 5816, 15207, 8878, 7066, 929, 14112, 9032, 3721,
+      324, 11646, 14054, 5156, 10661, 12484, 7754, 10156, 13085, 9273, 14743, 4635,
+      14091, 8269, 3823, 10235, 7807, 12163, 1802, 8489, 15698, 2849, 11493, 1061,
+      4476, 12488, 100, 11885, 3633, 12852, 5222, 11215, 6564, 7915, 775, 4938,
+      8960, 14380, 10463, 3086, 1185, 8313, 5332, 979, 6182, 9633, 78, 16091,
+      5717, 8940, 2521, 7017, 1079, 12942, 2070, 11206, 3231, 4638, 10021, 11616,
+      77, 15580, 3040, 7285, 14216, 5035, 9936, 6131, 14801, 8282, 1699, 6958,
+      2801, 4729, 9503, 427, 4453, 7639, 11955, 8479, 11451, 7226, 10489, 12190,
+      8163, 6113, 11248, 7343, 3616, 14567, 5236, 590, 16175, 11759, 9916, 15433,
+      620, 11937, 16093, 8795, 14200, 7679, 3607, 9127, 942, 9971, 2017, 6836,
+      12750, 16168, 2588, 8300, 11181, 7193, 10268, 2878, 8337, 6640, 15016, 1564,
+      12344, 2836, 13682, 4077, 15617, 4973, 11042, 15316, 7785, 4457, 1477, 8672,
+      6530, 14736, 2560, 76, 6812, 2970, 11916, 737, 6683, 12375, 5616, 16089,
+      2587, 5175, 10936, 13032, 221, 5050, 8737, 15331, 10571, 7812, 15682, 5899,
+      14792, 7587, 990, 15377, 2180, 12532, 13749, 3038, 6845, 1966, 7768, 15615,
+      6227, 13319, 10195, 15853, 14058, 4532, 8169, 13582, 11429, 4687, 15281, 10985,
+      9151, 5574, 10193, 8486, 15939, 13351, 5803, 14451, 4269, 10397, 5937, 1888,
+      10664, 16097, 2469, 1023, 12460, 3019, 11424, 14165, 8688, 12105, 2188, 15762,
+      10575, 14277, 3469, 5847, 158, 15627, 2338, 4242, 14883, 1134, 16305, 1925,
+      13556, 9102, 2603, 10553, 8291, 3695, 2138, 12744, 4231, 9701, 1684, 12479,
+      5181, 1254, 13439, 11875, 6259, 13063, 8072, 14515, 99, 10512, 5660, 14311,
+      607, 15907, 3863, 14577, 202, 9759, 3567, 10450, 7330, 4750, 10970, 1818,
+      8174, 12461, 1209, 5652, 12232, 14922, 10063, 13133, 719, 4642, 11640, 13932,
+      10728, 16329, 5307, 9897, 2079, 10857, 858, 9358, 13322, 6630, 14820, 4205,
+      7231, 10124, 13638, 1769, 6793, 2952, 9774, 1532, 8797, 2839, 13823, 9009,
+      4191, 9671, 5804, 10581, 16347, 11958, 5348, 9425, 11225, 4203, 1778, 7441,
+      2451, 11058, 6801, 1923, 3306, 7645, 585, 13186, 2344, 15543, 4338, 403,
+      7115, 1290, 8720, 2127, 7457, 13197, 8764, 12492, 3912, 6732, 8843, 13426,
+      7154, 9622, 4406, 5849, 743, 14839, 6508, 8201, 5495, 995, 9714, 14776,
+      12665, 8921, 6205, 13785, 9654, 3388, 5437, 8288, 11549, 5973, 15306, 13160,
+      4676, 14744, 7827, 5797, 14350, 7598, 3333, 6155, 10430, 15733, 8347, 4367,
+      15036, 3033, 5230, 11705, 4159, 7345, 13108, 3528, 6388, 12638, 9079, 6075,
+      11685, 15751, 5413, 13573, 434, 16150, 9509, 13161, 3230, 9932, 7235, 2767,
+      8600, 1978, 6849, 3225, 16017, 9561, 5994, 8238, 4307, 1668, 8703, 13280,
+      15737, 4682, 14651, 7494, 3722, 614, 9609, 2412, 16348, 12427, 3594, 5458,
+      14576, 12770, 4117, 11252, 13234, 6722, 10700, 5513, 12010, 209, 14847, 8407,
+      1173, 3837, 14073, 21, 2637, 14951, 12133, 8944, 12801, 3628, 15563, 9847,
+      12525, 14694, 10294, 6405, 3800, 11697, 13827, 5967, 12573, 9822, 3947, 12067,
+      16378, 1127, 4979, 14976, 326, 13926, 11481, 4575, 14542, 430, 15880, 12897,
+      10627, 3704, 13337, 11374, 3092, 12409, 6719, 1946, 4885, 3068, 10822, 675,
+      7767, 11745, 14377, 9888, 4241, 316, 7643, 1608, 6510, 11372, 39, 10817,
+      2710, 13315, 11350, 14837, 210, 6851, 2440, 10895, 722, 9262, 15792, 1342,
+      8802, 15266, 1830, 9900, 11522, 1397, 4933, 13971, 1810, 7740, 2434, 11448,
+      8290, 5728, 1138, 6369, 14920, 4647, 12925, 16121, 10612, 13845, 5281, 11034,
+      7692, 1942, 14387, 3186, 12226, 14917, 6139, 3660, 7068, 8956, 2853, 12637,
+      10393, 13887, 7793, 11590, 6114, 956, 7904, 11324, 9022, 458, 6450, 15097,
+      4839, 786, 16196, 3178, 7786, 13168, 2593, 4695, 12807, 9880, 7150, 12531,
+      8420, 6686, 4841, 454, 5999, 14197, 805, 5685, 8608, 1456, 4971, 14031,
+      8758, 7592, 1731, 10675, 15374, 2562, 14632, 10719, 6505, 3408, 11511, 9600,
+      7860, 2932, 5827, 1498, 10770, 3497, 8572, 6911, 1596, 9396, 4842, 1356,
+      14075, 8727, 15825, 11091, 13595, 7146, 15976, 12370, 4618, 6559, 1311, 2817,
+      15715, 11989, 9471, 12598, 2980, 14033, 9209, 16010, 6653, 882, 9027, 4104,
+      12766, 9841, 4941, 14160, 7421, 12844, 6439, 10323, 2761, 11923, 5123, 8471,
+      15535, 7379, 2751, 10384, 12450, 4431, 9420, 15159, 3488, 14049, 11758, 7800,
+      2274, 11130, 75, 6010, 4150, 1094, 12586, 15172, 4204, 12962, 10562, 1133,
+      7251, 10049, 422, 11755, 1326, 11201, 5349, 1681, 5862, 15444, 1374, 4864,
+      14496, 9418, 2526, 13832, 4578, 16020, 8013, 2050, 9974, 12363, 8553, 1675,
+      15220, 5970, 11048, 7613, 15357, 2202, 5153, 15838, 3681, 13669, 9454, 16349,
+      10226, 7998, 11491, 3996, 15247, 6962, 2869, 11349, 171, 14906, 3174, 9039,
+      4602, 7675, 5487, 443, 8390, 13555, 1678, 5564, 15695, 10173, 12803, 7463,
+      15422, 5435, 12149, 2455, 15020, 7745, 16212, 10146, 6219, 4267, 2568, 7878,
+      539, 10019, 3867, 1754, 15137, 12913, 10376, 13490, 7230, 5116, 3712, 14954,
+      8545, 5302, 1651, 4521, 10339, 15178, 5352, 7727, 1639, 15430, 8657, 11926,
+      3756, 2163, 11309, 4429, 13831, 6790, 14482, 917, 4220, 13470, 8827, 16379,
+      6321, 855, 13126, 6753, 1680, 10188, 4264, 15669, 9351, 13565, 8446, 14648,
+      9608, 7160, 2808, 8958, 662, 5545, 8762, 15886, 4495, 13673, 8116, 14263,
+      9763, 14989, 13263, 8326, 11848, 4157, 9120, 13011, 3242, 10751, 15555, 6923,
+      1321, 10247, 12019, 3244, 14264, 5927, 4079, 11337, 9635, 3618, 14238, 578,
+      6419, 11344, 8838, 796, 10810, 1972, 11757, 3229, 1604, 4961, 13114, 2217,
+      10868, 13381, 9675, 15877, 5738, 12204, 6899, 13273, 1028, 12325, 13893, 9520,
+      4505, 14863, 7103, 12602, 4049, 748, 14292, 8941, 1889, 9820, 13895, 4581,
+      11113, 5683, 2875, 12973, 213, 15046, 9647, 5587, 14508, 11977, 6011, 9378,
+      7962, 3154, 5518, 8565, 1065, 14427, 10901, 689, 6934, 11550, 13054, 3067,
+      7985, 12298, 2506, 14205, 10966, 2946, 6166, 393, 16330, 5578, 14789, 8083,
+      456, 9685, 3224, 12691, 5949, 10624, 333, 3719, 8058, 14484, 10704, 5041,
+      8968, 12550, 2752, 5434, 798, 6632, 3652, 2014, 11652, 14166, 10420, 6399,
+      11912, 14556, 3017, 6609, 12659, 2259, 5463, 3292, 6527, 4323, 74, 15859,
+      6924, 2570, 11008, 6588, 8151, 243, 5693, 11715, 3775, 13362, 5438, 9177,
+      7241, 319, 14758, 13380, 6766, 1274, 8524, 10179, 13776, 3304, 12239, 14595,
+      4572, 7805, 6147, 14534, 12448, 7196, 15027, 9283, 6085, 1217, 7667, 3742,
+      2061, 9338, 4161, 16208, 5891, 11131, 1815, 15811, 2818, 11041, 9114, 2486,
+      10867, 6806, 4983, 2865, 11422, 6584, 241, 8221, 14343, 886, 12075, 8582,
+      7276, 11591, 13415, 1690, 4403, 8321, 2657, 14708, 11256, 127, 16067, 12320,
+      2481, 10038, 6009, 16331, 2364, 9814, 15352, 6280, 13906, 1168, 9642, 6386,
+      12928, 4569, 10187, 13377, 7677, 9464, 1267, 13227, 5779, 16055, 11020, 7844,
+      2361, 14971, 12115, 5443, 9721, 2133, 3337, 15796, 195, 14687, 7012, 13912,
+      12078, 10347, 15754, 4956, 8022, 507, 3927, 16234, 2039, 7846, 11313, 98,
+      9184, 11127, 15634, 12360, 2102, 7908, 10669, 3526, 9559, 14615, 878, 16029,
+      13624, 4606, 12696, 9659, 7810, 2442, 14814, 1565, 12747, 10584, 8117, 2234,
+      4688, 12470, 15568, 4232, 5598, 1500, 7501, 5929, 10066, 15611, 933, 8659,
+      4160, 10522, 208, 3307, 15758, 4663, 12509, 14498, 10962, 13622, 715, 10159,
+      2532, 7959, 3860, 6858, 12211, 5851, 263, 16128, 13450, 8478, 15225, 12334,
+      4131, 16145, 12510, 3536, 9930, 6513, 3999, 14647, 2238, 3815, 6678, 10840,
+      16369, 12541, 879, 13601, 4896, 7389, 9562, 4100, 6781, 13777, 3405, 8270,
+      12217, 4124, 397, 8833, 4889, 11660, 3720, 16105, 844, 8494, 14667, 1591,
+      11044, 4254, 12092, 3151, 8932, 1885, 4593, 14007, 9519, 6977, 1541, 15334,
+      13585, 11308, 7381, 11942, 5843, 8318, 11096, 1449, 7944, 2904, 12866, 6267,
+      15119, 12152, 5499, 13191, 9818, 4799, 13774, 15187, 5893, 3882, 913, 8579,
+      15278, 12985, 5079, 13904, 1890, 12474, 5249, 3114, 8952, 2200, 15235, 1149,
+      13919, 6218, 11069, 4604, 15338, 3420, 5498, 16084, 10348, 7478, 2563, 11770,
+      9078, 16224, 12894, 2388, 13715, 3458, 11263, 13278, 2167, 6354, 14266, 7895,
+      11463, 8930, 629, 6334, 8251, 4788, 7326, 11972, 14682, 9270, 13407, 10311,
+      1377, 14362, 7761, 5184, 3500, 1508, 10046, 890, 7561, 9182, 5748, 1409,
+      13264, 15810, 9090, 5372, 10467, 15679, 757, 8973, 3137, 7221, 10231, 6398,
+      3363, 15103, 1777, 14161, 11622, 8826, 1626, 13192, 5524, 7641, 14125, 10820,
+      2251, 15209, 7455, 9202, 5266, 12027, 3540, 6418, 2483, 15468, 6814, 10545,
+      14851, 12381, 6521, 666, 11795, 3309, 8622, 4351, 6451, 718, 8871, 4133,
+      13411, 2382, 3836, 16274, 4807, 9431, 1157, 10659, 1856, 9122, 3008, 8179,
+      977, 6909, 3655, 1736, 10677, 7185, 13607, 10181, 5845, 1096, 11698, 8779,
+      6072, 7611, 10324, 12021, 6216, 11199, 7220, 3397, 9031, 16227, 870, 8346,
+      6779, 11886, 1020, 9051, 13008, 126, 5865, 14487, 1002, 10293, 4033, 8510,
+      125, 9524, 7004, 5010, 15831, 9206, 11898, 5239, 2335, 13874, 10255, 2834,
+      15971, 1782, 14069, 3159, 6416, 149, 4931, 14969, 8526, 4251, 12837, 9704,
+      12070, 6380, 14167, 5362, 12923, 2197, 14429, 11234, 7232, 1953, 11725, 1058,
+      12786, 7734, 4620, 13139, 5642, 14895, 2131, 11790, 8485, 12701, 10552, 5892,
+      404, 4824, 14703, 10999, 958, 15546, 3260, 12817, 6795, 10364, 176, 13122,
+      2228, 7258, 15774, 12496, 8197, 13997, 5152, 97, 7600, 3677, 8652, 15815,
+      5080, 14363, 10956, 12981, 2782, 16053, 12505, 1745, 10093, 15197, 9225, 6404,
+      13129, 14659, 7217, 4327, 13487, 6733, 14247, 10959, 15516, 12464, 10084, 8381,
+      12796, 16164, 4847, 2540, 14529, 7387, 3129, 16306, 357, 14391, 4139, 15620,
+      596, 14331, 10023, 5581, 12371, 4222, 10077, 12995, 2185, 9645, 13891, 6486,
+      3356, 14966, 10724, 8064, 3097, 6700, 11410, 15067, 5694, 12356, 14889, 1139,
+      10965, 3599, 837, 13453, 7060, 3944, 14880, 5337, 11855, 9993, 8881, 5304,
+      15454, 11316, 2236, 6557, 3146, 10568, 972, 15060, 2306, 8039, 11274, 3241,
+      15394, 10432, 3806, 8686, 5033, 3054, 14202, 6265, 3361, 9436, 14335, 11282,
+      1242, 9620, 4454, 15908, 528, 5008, 2635, 7839, 15720, 9843, 7164, 4214,
+      9598, 6189, 8385, 1468, 5368, 13648, 4348, 14857, 11022, 9518, 1120, 4145,
+      10144, 1393, 9249, 12710, 2373, 10923, 13342, 1637, 9990, 6100, 164, 7532,
+      9801, 4893, 6964, 14476, 5447, 7351, 1213, 10698, 3194, 143, 11220, 16001,
+      2564, 10042, 314, 4179, 5852, 2443, 14873, 5401, 3044, 674, 9460, 12189,
+      8323, 11037, 4558, 10088, 12663, 2816, 9720, 1977, 8005, 4858, 2490, 13668,
+      163, 7608, 2820, 14370, 5303, 15547, 4414, 1768, 11802, 8707, 3984, 13991,
+      12553, 5019, 13803, 1550, 7634, 4425, 2812, 8209, 6179, 12576, 8500, 16250,
+      1632, 10884, 8593, 7516, 459, 3865, 12748, 1201, 8372, 13076, 9625, 15738,
+      11748, 13913, 7272, 5794, 4009, 15797, 9320, 38, 6567, 8152, 1192, 14968,
+      12555, 9798, 7951, 10748, 15230, 142, 5900, 2717, 8276, 13810, 11120, 7461,
+      13493, 9048, 14653, 11840, 3553, 12891, 2008, 15098, 2697, 12592, 11477, 16178,
+      9749, 2688, 8726, 6587, 3200, 5501, 11538, 14431, 5886, 13303, 3843, 16219,
+      6012, 15040, 4452, 7315, 2728, 12106, 15561, 2093, 13769, 10741, 3369, 11351,
+      347, 12733, 14221, 4976, 12234, 8890, 5555, 8054, 12580, 5088, 14803, 7468,
+      11808, 9243, 1219, 13564, 7968, 11567, 6820, 3760, 429, 13628, 2022, 7037,
+      5277, 8490, 13779, 6438, 12999, 11690, 15341, 8435, 11158, 15677, 6326, 10733,
+      438, 8142, 11268, 7406, 15852, 5427, 1988, 7123, 595, 8980, 2625, 9661,
+      16052, 11145, 13518, 10074, 14439, 2401, 4397, 9957, 5857, 12127, 2057, 13116,
+      15421, 6876, 14554, 10909, 4326, 2876, 7428, 628, 5468, 2064, 9119, 11147,
+      13101, 1667, 4840, 12138, 13603, 4290, 11487, 6015, 390, 16275, 4022, 1509,
+      13347, 7119, 12365, 16082, 4028, 6365, 968, 3504, 5817, 1640, 10086, 6590,
+      1307, 5395, 11239, 8213, 13923, 4898, 300, 3884, 7216, 14215, 12090, 1295,
+      15601, 12723, 8391, 558, 7465, 2744, 11682, 8250, 10199, 764, 9428, 12647,
+      14633, 8038, 4527, 9007, 5877, 1071, 15287, 8484, 4396, 9677, 2331, 7866,
+      15585, 1801, 13867, 3690, 1570, 8761, 11265, 1396, 16134, 3936, 6750, 10346,
+      4190, 14084, 1840, 15818, 5526, 9019, 15533, 11460, 14622, 994, 10973, 4486,
+      9231, 1245, 3663, 6164, 2086, 4666, 12135, 8787, 3728, 13529, 2695, 9865,
+      532, 13396, 10210, 15041, 11129, 15706, 6070, 13057, 3713, 476, 6516, 1759,
+      5314, 15404, 7595, 13181, 96, 15181, 4965, 3394, 10610, 5667, 2515, 7787,
+      16251, 5942, 14038, 12429, 8396, 3699, 16139, 366, 6906, 10315, 14727, 7621,
+      2398, 15872, 9237, 13309, 2644, 6976, 12009, 5411, 8653, 4343, 10148, 1672,
+      11621, 14788, 9382, 12523, 10735, 15673, 4253, 13801, 8831, 16276, 6313, 876,
+      10490, 6830, 9155, 14849, 11149, 711, 5232, 10491, 7309, 2077, 4736, 15866,
+      10499, 14878, 6774, 1524, 4966, 14259, 3269, 5557, 980, 11276, 3347, 14119,
+      11853, 7756, 2523, 13475, 6194, 16021, 11703, 6462, 4066, 10269, 6933, 11966,
+      15671, 6358, 13285, 3030, 8188, 13813, 12327, 11, 15367, 5742, 9674, 12607,
+      10441, 2903, 6239, 1536, 3844, 7653, 15931, 3064, 14465, 7273, 10466, 13167,
+      9719, 13952, 1085, 14931, 5801, 11827, 6605, 14383, 4664, 12244, 6292, 2931,
+      4536, 7929, 1357, 10739, 7114, 8852, 12277, 13935, 9266, 773, 11788, 3249,
+      8798, 6493, 13962, 9013, 989, 12487, 9617, 363, 11896, 1664, 10400, 4421,
+      14660, 9844, 12155, 5163, 13993, 3004, 8839, 5713, 10515, 1467, 7152, 4908,
+      10908, 8885, 14630, 2444, 11002, 15604, 3143, 8998, 7635, 4707, 2328, 14174,
+      8055, 2857, 7229, 95, 12350, 3052, 13477, 4055, 15451, 1939, 13237, 5838,
+      2418, 8497, 15267, 4018, 14001, 9850, 13451, 3468, 8917, 1819, 4374, 13855,
+      12062, 7095, 10995, 8601, 15858, 6484, 10169, 642, 16277, 5189, 9737, 12174,
+      1600, 3543, 9040, 495, 12781, 14671, 2897, 9400, 857, 4385, 9986, 5593,
+      10673, 2144, 5146, 8816, 11209, 2478, 7796, 3986, 15228, 12169, 8192, 13425,
+      10344, 12469, 6025, 281, 11235, 5431, 16188, 541, 7939, 3390, 7050, 10119,
+      2213, 16350, 1131, 8994, 3100, 8126, 1303, 9601, 13948, 12046, 3262, 14599,
+      4998, 15474, 2492, 4023, 10979, 6842, 4939, 13804, 10427, 2616, 11391, 7434,
+      15993, 4703, 13778, 6459, 14471, 8599, 3122, 7198, 1012, 6175, 2663, 7859,
+      11535, 4477, 643, 15112, 3683, 12323, 14358, 3339, 15637, 1160, 6210, 13504,
+      825, 6550, 13754, 367, 15244, 13009, 6997, 551, 5219, 11974, 15158, 11018,
+      4884, 9981, 7284, 9221, 12156, 7917, 3516, 10103, 12552, 6797, 13103, 2803,
+      8181, 20, 6524, 11437, 5265, 13137, 10910, 8472, 200, 15472, 2441, 13106,
+      1763, 4768, 12560, 7122, 2194, 10987, 4041, 6931, 14848, 10795, 5441, 15401,
+      8113, 1364, 5762, 11352, 14040, 7576, 15148, 608, 14409, 7254, 15749, 3434,
+      6533, 13277, 14505, 1296, 6951, 4557, 94, 15079, 5038, 2035, 9538, 13523,
+      8127, 2249, 4359, 11589, 5646, 15597, 12340, 4469, 8012, 10579, 5101, 12601,
+      14893, 10828, 16061, 7411, 37, 5745, 9076, 12625, 1038, 10009, 5870, 7880,
+      16099, 1971, 14940, 8153, 1266, 15521, 4285, 1438, 10176, 2811, 8170, 3813,
+      10836, 5095, 13177, 15660, 10879, 12727, 15218, 1371, 14546, 9505, 12816, 11056,
+      6401, 8547, 310, 10197, 7885, 12877, 3805, 9746, 8198, 12036, 5227, 11356,
+      6022, 3254, 10540, 15986, 9619, 1496, 8631, 5923, 2147, 14953, 668, 2569,
+      5084, 14322, 1147, 15977, 4427, 1521, 9544, 5864, 16161, 12317, 2471, 15213,
+      943, 7747, 16088, 3195, 5754, 9192, 4141, 6752, 14157, 9472, 2707, 13492,
+      8744, 15019, 93, 13783, 8006, 1045, 12498, 2600, 9852, 4580, 13419, 8442,
+      3780, 2264, 12388, 9056, 3278, 11489, 1440, 12776, 10211, 682, 5172, 11371,
+      2170, 13015, 9761, 3377, 8810, 6839, 15190, 4058, 12097, 14681, 9330, 13433,
+      1583, 8684, 2612, 14753, 53, 13211, 3624, 7179, 1605, 5537, 4060, 13038,
+      11197, 14805, 4404, 2340, 7392, 11578, 14244, 194, 12438, 9516, 3631, 11474,
+      5569, 7041, 12249, 13566, 6236, 14804, 11517, 1854, 15884, 817, 9482, 2184,
+      4882, 8544, 3955, 10388, 5758, 2366, 7318, 1216, 16193, 4693, 13640, 5671,
+      2233, 11655, 5167, 15013, 2622, 14280, 3842, 9710, 1727, 8903, 12247, 4173,
+      6512, 13681, 3662, 14393, 7730, 13075, 11412, 15759, 10706, 6693, 11714, 5663,
+      8683, 14537, 11627, 1066, 10547, 4916, 7088, 9612, 12715, 6154, 2101, 10118,
+      14396, 12597, 10689, 750, 11661, 7722, 15428, 4235, 6051, 12040, 3014, 5655,
+      9543, 4257, 13918, 7274, 11752, 15024, 6825, 92, 16307, 10183, 6669, 4747,
+      13145, 5822, 9533, 7542, 4322, 16351, 7996, 9353, 5889, 15875, 7483, 11893,
+      13765, 896, 10790, 2828, 5836, 691, 7371, 3251, 10243, 14270, 6656, 11387,
+      5484, 8865, 15713, 11552, 9781, 13995, 2594, 6497, 1843, 8223, 10470, 16176,
+      13340, 3148, 4566, 8825, 2669, 6323, 13083, 815, 13920, 9740, 2139, 8671,
+      4937, 182, 12846, 9277, 5570, 7936, 12290, 6306, 14220, 161, 6965, 13230,
+      8696, 15525, 5065, 13311, 9590, 2887, 11879, 7394, 15264, 8934, 442, 10718,
+      7094, 1379, 7993, 16352, 13236, 7257, 792, 14352, 2353, 12545, 10343, 992,
+      9430, 3298, 6341, 4318, 8502, 166, 13552, 2324, 11007, 3461, 7451, 13597,
+      3923, 9063, 14756, 3400, 10785, 4256, 13685, 7259, 1114, 5014, 8032, 15962,
+      3418, 5479, 497, 10869, 1602, 7659, 10029, 12634, 16135, 2085, 10456, 5788,
+      3525, 1872, 9228, 12581, 5554, 11202, 1228, 15608, 8218, 272, 15127, 13805,
+      2032, 11657, 3125, 14227, 10808, 3854, 1384, 5568, 2679, 16353, 7815, 12774,
+      8840, 10649, 15803, 6279, 11933, 4646, 807, 9613, 13782, 1648, 2856, 6201,
+      854, 8534, 12122, 10058, 15243, 3319, 6768, 594, 9327, 6090, 15359, 11101,
+      13792, 4720, 10386, 7632, 4206, 16215, 3422, 10983, 15364, 7674, 3265, 6769,
+      14057, 4083, 15366, 3182, 9760, 12000, 16332, 3021, 1032, 11675, 3295, 8128,
+      1694, 10841, 14449, 1337, 4208, 13560, 6574, 15878, 3555, 12515, 10383, 4854,
+      2460, 14984, 5370, 11165, 8073, 4802, 6967, 16157, 5331, 12273, 1437, 10079,
+      14004, 3638, 9481, 7601, 15336, 415, 5358, 15565, 2231, 12966, 1314, 7851,
+      388, 15684, 8598, 11727, 3600, 15117, 2210, 6151, 10300, 14460, 12382, 9049,
+      13969, 15657, 4681, 1171, 6777, 8679, 14417, 361, 15889, 10894, 4390, 14483,
+      2947, 7758, 3945, 13879, 2514, 10417, 3667, 5274, 8922, 6338, 13127, 501,
+      8383, 12199, 14822, 9902, 11411, 6299, 4529, 1528, 15017, 4912, 2069, 13812,
+      1277, 8067, 16138, 3675, 6897, 11794, 7979, 14715, 4850, 15509, 7268, 475,
+      5397, 13858, 12413, 4913, 10890, 1933, 8204, 1220, 7099, 15873, 1686, 14520,
+      9097, 482, 12654, 6478, 1318, 9689, 14563, 11065, 2301, 10398, 571, 11436,
+      7334, 2002, 4673, 10658, 6250, 13890, 10039, 14826, 6649, 3967, 8817, 6140,
+      10354, 2958, 11459, 4906, 9014, 14490, 52, 6522, 11951, 8690, 3288, 9728,
+      15697, 192, 11564, 2498, 13703, 8069, 15319, 7005, 2068, 16308, 4725, 12906,
+      6378, 9931, 12362, 8496, 6783, 11311, 5776, 13863, 11983, 5185, 1847, 5858,
+      13369, 11055, 8780, 13762, 1203, 8330, 4789, 2404, 6480, 3551, 11218, 13675,
+      2789, 5059, 11904, 7549, 12712, 6247, 8103, 1013, 11654, 14928, 9297, 11826,
+      6082, 12689, 7138, 10992, 880, 15431, 10053, 4798, 15653, 6570, 3015, 7941,
+      695, 14373, 9241, 13348, 6622, 11363, 3785, 9566, 12800, 5604, 10762, 2193,
+      15168, 9862, 3976, 12526, 10442, 3193, 13176, 4138, 11079, 8399, 1512, 15500,
+      7438, 14274, 12584, 3958, 9658, 12005, 3190, 6202, 11623, 5042, 7999, 13712,
+      4445, 12180, 5255, 1021, 13432, 6371, 8636, 14808, 5509, 14016, 9368, 12511,
+      7458, 4302, 498, 5571, 12693, 15453, 141, 13200, 15721, 8028, 973, 13002,
+      2038, 7464, 4268, 15554, 10720, 1036, 13933, 6716, 1919, 13095, 8987, 3969,
+      10727, 529, 4523, 11264, 12445, 5856, 10866, 1421, 3000, 14441, 4522, 877,
+      10329, 3201, 15061, 8877, 3840, 10225, 14582, 9385, 288, 6918, 4361, 12023,
+      3012, 6856, 16309, 10549, 12745, 904, 8882, 7337, 15414, 9690, 3825, 1702,
+      9413, 2479, 13992, 9965, 6808, 2003, 5410, 759, 8447, 16120, 1489, 14628,
+      12183, 3366, 7498, 2080, 9143, 1148, 13418, 4985, 12589, 3878, 10413, 3051,
+      27, 8499, 14388, 7527, 2854, 14902, 8772, 12331, 4803, 1398, 14301, 287,
+      6715, 2081, 9442, 15981, 6300, 2745, 9568, 4042, 11851, 2930, 5503, 15082,
+      425, 5284, 8504, 13256, 2414, 15157, 9933, 1901, 15586, 2590, 8818, 16278,
+      7966, 4576, 12718, 1691, 3764, 8386, 664, 14591, 2330, 15970, 8966, 11012,
+      2504, 7769, 11699, 5157, 2128, 9713, 14797, 6056, 9904, 11806, 13472, 2990,
+      7721, 5618, 12682, 3845, 14474, 5158, 7429, 15208, 6026, 9693, 13911, 2991,
+      7744, 685, 8306, 15120, 11913, 9020, 2067, 13701, 16370, 5064, 1572, 7038,
+      2461, 13136, 7426, 3280, 16172, 10262, 1696, 15479, 9554, 13077, 187, 4129,
+      7891, 14745, 5257, 12442, 589, 11109, 14899, 13384, 5202, 15196, 3613, 12285,
+      4579, 15941, 10204, 13462, 4357, 2825, 9618, 4639, 8189, 5853, 14261, 12670,
+      11177, 5750, 10381, 14639, 8623, 2037, 15317, 7443, 12112, 16098, 5387, 1083,
+      11628, 4198, 220, 6429, 7877, 13044, 5887, 8428, 11236, 14180, 7684, 1388,
+      11680, 14472, 12997, 6878, 124, 9928, 8630, 6712, 13078, 10416, 15507, 1109,
+      10830, 6696, 3754, 11506, 7492, 10554, 6117, 3620, 11315, 2473, 9867, 15919,
+      10811, 13190, 5930, 3414, 8199, 11874, 1497, 13698, 4743, 10414, 3379, 6957,
+      12494, 4238, 7323, 3212, 16126, 5336, 730, 9193, 14738, 1808, 10000, 8268,
+      10670, 2682, 11954, 965, 12575, 2286, 8533, 5229, 14728, 13070, 10010, 4099,
+      5469, 7312, 11430, 6057, 7781, 12768, 9475, 11779, 15822, 5968, 1241, 11596,
+      4777, 12865, 5924, 7732, 3943, 11083, 5831, 15125, 9871, 1974, 10655, 3413,
+      6149, 2354, 8082, 6736, 804, 11180, 6004, 309, 8309, 12675, 3082, 7541,
+      14303, 11533, 6390, 12911, 2397, 10555, 91, 4314, 2283, 15216, 3674, 344,
+      6751, 11462, 5812, 13816, 4270, 1887, 10603, 13259, 6886, 10008, 13576, 15857,
+      10964, 2832, 9414, 16310, 5182, 3637, 12805, 5589, 8697, 739, 5013, 10746,
+      16333, 13454, 1407, 11105, 2271, 3679, 7036, 4652, 14304, 8333, 217, 5330,
+      14420, 938, 12829, 15018, 123, 13868, 6896, 5053, 1024, 7167, 11327, 15413,
+      10136, 5322, 6843, 15261, 8440, 911, 16210, 9145, 14408, 546, 11746, 13643,
+      1460, 8492, 11255, 6223, 11990, 4771, 16217, 365, 6293, 15626, 9523, 3598,
+      14271, 6604, 16051, 10558, 1603, 6529, 2633, 13536, 452, 15418, 3670, 9878,
+      2777, 122, 14481, 4735, 753, 11126, 8927, 14796, 8120, 2703, 13917, 953,
+      14566, 2222, 8937, 13609, 3160, 6868, 13356, 16063, 9252, 13073, 4148, 10409,
+      16252, 8519, 13229, 9716, 14750, 1390, 6541, 10775, 240, 8847, 15499, 1136,
+      13818, 8660, 16334, 7165, 13650, 8045, 9587, 12212, 16151, 4677, 1044, 8945,
+      10133, 6485, 3358, 8715, 15616, 2161, 5703, 3601, 1243, 14702, 4282, 1958,
+      11883, 683, 14784, 10476, 4260, 15293, 7868, 2134, 6206, 3406, 4691, 15310,
+      13800, 8109, 12254, 9468, 3061, 12974, 16125, 12101, 8950, 4368, 6982, 9757,
+      5534, 8965, 11917, 3199, 8749, 14243, 2110, 4547, 167, 13242, 3794, 2075,
+      12117, 6078, 13134, 1900, 5546, 10209, 8145, 4641, 10813, 2824, 15354, 3890,
+      14120, 2561, 7100, 12347, 13787, 1253, 5586, 7771, 10918, 4386, 51, 12083,
+      3661, 9555, 15787, 7554, 10407, 12700, 1473, 14669, 12052, 8506, 3566, 10569,
+      7615, 14187, 4054, 1994, 6372, 11869, 9912, 8521, 5285, 12491, 7134, 1263,
+      5138, 11934, 331, 4537, 7127, 14617, 1305, 12437, 2962, 4640, 1944, 7199,
+      3522, 11501, 4689, 15723, 2445, 5466, 3592, 7292, 11401, 3131, 5211, 11956,
+      3993, 1278, 6062, 2889, 7726, 9848, 12926, 2783, 15675, 11901, 14312, 708,
+      4435, 12141, 8173, 9753, 12641, 6900, 10462, 13537, 7617, 9739, 6767, 1922,
+      12338, 3299, 13375, 9321, 14384, 12043, 7427, 9150, 5659, 1543, 15840, 696,
+      5502, 10277, 1717, 6366, 2846, 13825, 1911, 11673, 2910, 14608, 1226, 15496,
+      12858, 5585, 9652, 12373, 7433, 15001, 10798, 9322, 14438, 4134, 7894, 10883,
+      3273, 15624, 2201, 14852, 6633, 13082, 7596, 1297, 9570, 8182, 10960, 4221,
+      3132, 8426, 11581, 15008, 1403, 13466, 9220, 7642, 14938, 4757, 11674, 1956,
+      5983, 8689, 4437, 7126, 5366, 15870, 6474, 13730, 2650, 5582, 9785, 12755,
+      15882, 50, 4335, 15396, 11375, 3296, 16038, 10772, 7849, 15182, 8665, 10375,
+      1841, 11469, 5601, 9349, 6400, 14477, 10203, 15594, 5635, 13881, 8180, 13243,
+      9743, 12444, 14390, 10116, 6014, 14794, 1587, 9944, 15812, 11086, 12819, 14172,
+      1612, 15010, 3917, 7271, 401, 5026, 7640, 11238, 6242, 14189, 1004, 15350,
+      4742, 8676, 385, 5956, 15206, 2573, 4977, 16066, 8887, 7064, 11188, 1132,
+      5228, 10314, 573, 12726, 2863, 10100, 6477, 14101, 11805, 7250, 3949, 9784,
+      15116, 10468, 7537, 15937, 4298, 8138, 6063, 10302, 3847, 745, 16335, 2559,
+      8985, 5657, 1107, 7093, 2748, 11453, 245, 13746, 7110, 12627, 5976, 9289,
+      73, 10047, 5110, 11706, 13484, 679, 5520, 15443, 9914, 12961, 2036, 4860,
+      9857, 7029, 2949, 12847, 5908, 661, 8905, 13789, 3180, 16100, 10774, 13959,
+      1068, 10161, 1825, 9033, 12177, 15435, 1372, 7162, 3465, 10550, 7396, 2113,
+      6578, 461, 9212, 4247, 14163, 2367, 6061, 13705, 3115, 8243, 15780, 188,
+      13647, 7940, 1010, 11160, 2346, 9437, 1264, 3360, 6233, 1048, 7977, 4333,
+      489, 12405, 8897, 6457, 581, 5384, 8856, 4360, 10742, 6258, 11687, 13987,
+      8613, 13067, 2489, 15276, 9395, 3135, 10877, 6466, 2277, 14052, 11210, 3514,
+      12721, 8248, 11597, 13696, 297, 5805, 2883, 15457, 8219, 2459, 16006, 4074,
+      14732, 11537, 4441, 8296, 1976, 15300, 13232, 8143, 1319, 4809, 13429, 439,
+      9461, 13087, 2016, 7275, 11536, 8289, 6475, 11196, 14265, 3502, 12980, 16032,
+      5293, 9786, 15320, 4710, 9072, 1052, 3995, 11988, 13882, 3493, 15953, 2314,
+      6455, 14798, 12166, 1719, 7215, 6133, 16130, 3472, 14124, 5504, 15545, 1927,
+      11354, 14255, 6986, 4287, 12181, 247, 8052, 2699, 11717, 3989, 12870, 4909,
+      339, 10760, 8301, 14039, 5419, 12468, 14290, 9495, 13150, 14898, 5787, 12668,
+      1101, 11593, 3929, 15574, 12308, 4918, 10223, 3801, 11729, 2798, 12862, 4369,
+      6662, 12288, 15246, 7597, 11457, 16204, 2683, 10740, 15405, 7512, 3276, 14321,
+      7952, 2408, 15362, 7360, 26, 9323, 2111, 5691, 10541, 4073, 9858, 1485,
+      5207, 7867, 13313, 4020, 12330, 7510, 15924, 1711, 4598, 10153, 1300, 4002,
+      9549, 14644, 11991, 4485, 13707, 6509, 11062, 8663, 7203, 160, 13099, 2948,
+      10601, 5017, 341, 11191, 6035, 12286, 3130, 6445, 10708, 14392, 5105, 12455,
+      15188, 2917, 13824, 4733, 534, 8011, 11761, 1795, 8410, 12522, 6535, 2269,
+      14309, 10477, 16311, 8317, 1920, 5755, 7992, 10379, 4065, 8419, 2918, 9278,
+      14620, 239, 10623, 8664, 11998, 547, 10662, 8456, 3534, 9806, 1415, 15035,
+      9507, 5651, 13469, 6691, 9110, 15548, 7695, 14584, 6761, 3127, 4623, 11358,
+      2363, 8766, 1116, 4891, 3684, 10660, 8237, 2692, 10059, 6935, 9003, 654,
+      7605, 1490, 15052, 7108, 9011, 5446, 16047, 7718, 14269, 1, 5259, 10461,
+      4152, 12825, 9035, 13757, 4923, 1967, 13209, 10615, 12268, 13878, 3568, 11825,
+      13284, 15913, 3327, 14485, 1257, 16072, 6543, 13815, 12307, 49, 16253, 9532,
+      860, 10263, 5148, 9105, 13632, 6489, 15503, 7854, 10972, 1963, 7282, 10097,
+      700, 12591, 5416, 1465, 13637, 5932, 9343, 16336, 6572, 8946, 14480, 2642,
+      16042, 9402, 8041, 15166, 1445, 3499, 8991, 586, 4455, 9727, 1634, 10600,
+      15732, 6577, 10205, 3908, 14230, 954, 3689, 11141, 7841, 5263, 2541, 6433,
+      11244, 14443, 12463, 408, 15537, 11320, 5206, 13662, 4272, 11807, 5310, 2565,
+      7321, 13359, 4399, 6840, 16162, 5145, 13061, 7881, 2435, 11512, 4615, 14683,
+      676, 5863, 2267, 11393, 8794, 16075, 13004, 677, 14638, 6204, 16371, 12153,
+      7090, 1308, 13820, 4780, 15961, 13046, 5342, 10930, 13447, 6097, 11179, 2255,
+      14596, 692, 9832, 3442, 10849, 8790, 2770, 14147, 1641, 5759, 747, 6665,
+      11845, 9592, 5774, 4162, 1354, 6286, 9705, 1870, 6720, 5106, 8167, 12465,
+      7046, 11651, 3113, 8455, 10712, 2787, 6824, 5491, 15026, 3209, 6773, 14850,
+      157, 12096, 2528, 5922, 13287, 5007, 15895, 3609, 9080, 15212, 2775, 10031,
+      15606, 3692, 11334, 974, 13784, 3524, 11902, 7288, 4278, 720, 12941, 5439,
+      11547, 6916, 16133, 10916, 13602, 6990, 12651, 5729, 8923, 2413, 13578, 5150,
+      7363, 9513, 15861, 13183, 359, 12238, 14716, 9631, 1281, 4244, 9356, 6972,
+      13317, 1193, 7355, 10229, 1430, 8208, 12855, 15504, 1579, 9663, 14846, 1041,
+      11600, 2732, 10858, 6127, 15674, 1043, 10127, 3539, 12585, 10580, 14089, 3729,
+      1143, 5656, 9457, 7496, 10359, 3171, 7988, 9970, 2447, 15531, 11441, 7698,
+      72, 3202, 14763, 2232, 9632, 3401, 13977, 4745, 12798, 6534, 12207, 1884,
+      5876, 15711, 12599, 6888, 9918, 14941, 8509, 3177, 15854, 48, 14749, 9172,
+      16354, 10967, 4740, 14854, 11214, 769, 10405, 4424, 9250, 383, 5553, 14960,
+      4515, 14108, 8895, 11777, 1800, 10912, 12666, 2416, 8137, 10687, 3732, 14332,
+      564, 8155, 12661, 1335, 6904, 11518, 4402, 7892, 12233, 2025, 5231, 7755,
+      12374, 1704, 5756, 9953, 13519, 10961, 2351, 4029, 13798, 8260, 2709, 5627,
+      1287, 8190, 3316, 14782, 4126, 11531, 799, 15064, 12113, 2807, 5707, 8518,
+      4591, 7163, 3324, 13521, 7705, 15766, 2403, 5300, 3402, 8948, 14403, 2623,
+      15726, 6463, 3723, 9135, 5991, 3250, 12368, 5629, 8801, 14015, 348, 3983,
+      12143, 6978, 8325, 16337, 2063, 7420, 5183, 9830, 13420, 11852, 2527, 15144,
+      4533, 11610, 231, 13897, 5567, 9087, 3467, 6257, 9777, 11749, 8035, 4631,
+      16355, 8609, 343, 7836, 10452, 3708, 14823, 8062, 13534, 1395, 4704, 8200,
+      3649, 11571, 13324, 4637, 10104, 7638, 2668, 6912, 13374, 480, 7808, 2746,
+      8718, 15575, 13028, 2533, 15263, 13406, 10291, 2020, 7404, 1327, 12936, 3612,
+      8239, 14268, 4413, 9724, 5328, 16279, 7239, 9154, 11611, 2759, 10654, 14459,
+      5140, 13503, 351, 14386, 6109, 8837, 15084, 10069, 4408, 15735, 8645, 1129,
+      15122, 6134, 8830, 15770, 9898, 36, 12608, 14435, 9455, 15529, 11321, 306,
+      13940, 7693, 5935, 9118, 1669, 11026, 14785, 10250, 1876, 15584, 11683, 755,
+      5579, 13014, 10459, 12044, 14886, 6124, 12379, 4474, 11167, 13496, 731, 14543,
+      11118, 13905, 7989, 2043, 15371, 7059, 10201, 8516, 14521, 2928, 13517, 5784,
+      9285, 12201, 153, 14861, 7947, 4109, 6834, 1423, 12650, 5898, 15314, 4216,
+      13066, 1034, 12513, 15175, 2026, 13686, 6119, 853, 12549, 6618, 12014, 15530,
+      1442, 9054, 5176, 11227, 3175, 9579, 11751, 791, 16035, 2305, 7322, 1368,
+      11242, 13843, 12116, 3602, 9626, 5472, 12628, 14177, 3773, 5689, 1520, 7788,
+      6096, 3880, 8224, 12276, 15888, 9984, 5190, 15462, 6209, 542, 7545, 13835,
+      1446, 13115, 873, 4863, 15057, 6621, 3961, 8872, 2239, 7543, 9485, 3041,
+      10988, 852, 12694, 2722, 6384, 10928, 14110, 5104, 3240, 7753, 12008, 1747,
+      6488, 4915, 10496, 3605, 6437, 4697, 2302, 6831, 9314, 12521, 3053, 15955,
+      4607, 6784, 690, 3834, 13734, 8824, 6289, 10089, 3634, 8564, 562, 7398,
+      1945, 10602, 148, 7081, 8635, 2246, 9959, 7377, 4865, 121, 10309, 4172,
+      11962, 3163, 5097, 12945, 1638, 4774, 10933, 1225, 4219, 15376, 3340, 6322,
+      1804, 15918, 10665, 13688, 8914, 7270, 2702, 10832, 8196, 6645, 10257, 4962,
+      8529, 4053, 10722, 14300, 9926, 2094, 4230, 5614, 13758, 2677, 16179, 909,
+      7256, 15274, 5974, 14030, 10271, 5205, 9398, 15517, 6001, 1891, 5125, 8245,
+      15432, 11366, 1809, 10216, 7000, 12198, 14000, 9966, 11797, 800, 14573, 3291,
+      6363, 294, 11355, 2458, 9217, 12110, 15830, 3252, 11495, 6196, 10108, 12271,
+      1794, 9791, 16114, 5944, 11111, 15307, 12949, 4737, 16007, 7013, 4057, 14504,
+      360, 7447, 2379, 12737, 10238, 399, 14302, 3755, 12884, 15114, 7696, 1816,
+      12144, 13355, 10266, 16209, 5030, 1882, 10330, 12939, 8162, 14168, 12386, 7681,
+      11159, 4883, 2465, 15183, 11419, 14329, 4690, 16356, 9332, 4035, 15240, 13050,
+      5445, 16155, 3930, 12431, 2580, 15661, 6913, 13253, 9354, 910, 14737, 11122,
+      6576, 9409, 15030, 7686, 13141, 10509, 8284, 11267, 12778, 9387, 5425, 3619,
+      831, 14568, 9584, 1732, 15963, 2914, 14560, 531, 12080, 15898, 1633, 7460,
+      3498, 14858, 11132, 9423, 7520, 11787, 6717, 9903, 12772, 4093, 8883, 2847,
+      6714, 12930, 313, 14198, 3762, 9058, 14919, 996, 2571, 4147, 6240, 16009,
+      259, 9169, 3192, 4717, 16357, 7003, 11005, 5029, 9491, 13631, 7072, 14442,
+      4723, 10488, 1772, 7104, 9037, 4087, 14150, 3043, 8388, 12773, 71, 13649,
+      1279, 3586, 6579, 1740, 9859, 13456, 8414, 11467, 9478, 13388, 4197, 8450,
+      15871, 5715, 10691, 7171, 9348, 905, 11539, 14646, 8812, 669, 7804, 3185,
+      11140, 14680, 6373, 120, 3439, 9638, 5220, 2630, 16312, 1022, 13257, 7566,
+      1631, 6623, 2899, 13226, 5622, 11868, 2766, 9795, 955, 10902, 6266, 14742,
+      8822, 11592, 5556, 1555, 16280, 6271, 7950, 2439, 15778, 312, 12011, 2833,
+      6464, 828, 5490, 14679, 3060, 591, 7663, 15342, 11250, 4339, 12418, 5654,
+      11560, 4514, 13325, 7813, 5796, 3075, 9308, 13187, 5367, 8403, 1092, 13270,
+      3776, 90, 14293, 4551, 2125, 14597, 446, 13483, 10903, 4233, 7948, 12071,
+      6583, 11049, 12901, 6796, 14242, 9100, 13156, 8211, 4964, 11271, 15090, 1206,
+      8854, 2680, 13842, 1710, 12123, 3047, 8254, 1464, 12982, 3669, 5802, 13520,
+      15315, 1982, 7627, 15772, 6422, 3792, 5260, 7816, 12020, 10385, 8444, 12311,
+      5727, 2915, 1237, 5262, 16372, 1785, 11866, 6798, 1435, 12390, 4603, 2317,
+      15539, 3233, 6088, 4489, 2611, 15254, 5867, 13718, 906, 8568, 3991, 15464,
+      11523, 1728, 15043, 10290, 6467, 9052, 11888, 5313, 9574, 12528, 10640, 8125,
+      865, 7536, 14289, 4731, 8229, 13413, 1842, 7840, 881, 14131, 3267, 8150,
+      11259, 4398, 13916, 10081, 3994, 8584, 5233, 14204, 9469, 15730, 2244, 8907,
+      4661, 14176, 12538, 2462, 8434, 6613, 13660, 407, 9260, 7021, 1412, 9634,
+      11077, 15025, 6679, 206, 11822, 15494, 2960, 6101, 15829, 10567, 5530, 12262,
+      7794, 11082, 5647, 7491, 1865, 14897, 3101, 10014, 1431, 2826, 4654, 10194,
+      7656, 11839, 1080, 3343, 13625, 2171, 7486, 5744, 13297, 10401, 5990, 8651,
+      14689, 4490, 16185, 11150, 6647, 14937, 9960, 47, 11283, 5376, 10542, 1535,
+      11762, 14896, 10062, 14378, 2153, 4868, 15813, 280, 14097, 10709, 15250, 7802,
+      3206, 6112, 14325, 9672, 3428, 14710, 9041, 13548, 11038, 8342, 13179, 10110,
+      7101, 11380, 9227, 4530, 12093, 6961, 13378, 9407, 7450, 5950, 12783, 395,
+      13604, 4276, 2874, 15458, 173, 3934, 14533, 2247, 15631, 10850, 6325, 1584,
+      15513, 3642, 11507, 5280, 10373, 4334, 9742, 13711, 2735, 12688, 593, 5773,
+      11416, 13379, 7376, 1673, 10887, 3803, 13545, 11555, 7027, 10752, 6161, 10094,
+      1289, 16085, 3297, 8001, 15191, 14026, 3789, 12698, 2298, 4755, 13953, 10382,
+      4288, 7061, 9899, 11691, 8205, 2350, 9236, 1389, 15425, 3460, 9794, 16313,
+      11636, 9139, 5317, 15666, 13646, 8525, 16199, 35, 3702, 5234, 14975, 10369,
+      6006, 14536, 9531, 12065, 3906, 323, 15595, 7380, 1099, 10538, 5769, 630,
+      8983, 2191, 7855, 12439, 2988, 8531, 12878, 4550, 8862, 1137, 2923, 6309,
+      9028, 13435, 7188, 4090, 8775, 6671, 4308, 12821, 9113, 11153, 46, 5165,
+      10893, 7869, 659, 6303, 1554, 5025, 16380, 190, 12572, 3552, 1851, 15696,
+      10017, 1413, 5298, 2377, 14137, 4346, 8498, 3368, 7333, 14541, 10781, 7817,
+      13482, 6396, 8971, 4935, 12318, 3611, 8851, 12534, 9987, 7200, 15011, 2794,
+      12214, 15974, 6226, 1276, 10539, 6792, 9138, 15467, 1561, 3094, 16127, 4540,
+      12351, 7743, 5955, 219, 16281, 1650, 3787, 14887, 5605, 11878, 10534, 5023,
+      2178, 10207, 5736, 16191, 7262, 1087, 8461, 2788, 12838, 1959, 14544, 577,
+      4826, 15059, 13091, 6581, 8650, 13321, 2448, 4722, 1316, 6472, 12684, 557,
+      7266, 11359, 6024, 12480, 9639, 2215, 6991, 8782, 12394, 530, 2998, 15940,
+      8056, 11389, 4776, 3184, 12992, 9401, 2619, 13659, 12006, 5005, 16013, 4229,
+      6903, 15160, 603, 13883, 7277, 11112, 13052, 15427, 572, 3223, 10816, 14690,
+      2507, 11847, 780, 14824, 2279, 7246, 15126, 12856, 2159, 16086, 4183, 12486,
+      14195, 7472, 2405, 8964, 14965, 5467, 14068, 7606, 3020, 12578, 16087, 10940,
+      728, 12126, 15683, 9530, 11741, 1187, 5961, 2265, 10342, 16111, 1122, 9996,
+      5928, 273, 13809, 2721, 5015, 555, 9226, 13250, 6887, 225, 8959, 15136,
+      4837, 14675, 3659, 7624, 12434, 9885, 6403, 8988, 927, 15285, 10125, 3136,
+      12151, 7925, 9453, 13023, 2858, 8774, 889, 13128, 6555, 11815, 256, 8750,
+      11299, 14462, 12275, 5719, 15997, 8793, 5453, 13651, 7417, 3248, 11172, 4146,
+      702, 5897, 12045, 13956, 8543, 14634, 2705, 9673, 4739, 3341, 1839, 15100,
+      13535, 11104, 16068, 1346, 4394, 10845, 6882, 5171, 1487, 14252, 9176, 15014,
+      11099, 6838, 15644, 8025, 3344, 14029, 9506, 1373, 13485, 10015, 6198, 3409,
+      16282, 5731, 4008, 7579, 9699, 12683, 5538, 1455, 9365, 13570, 5775, 10095,
+      12319, 4744, 3285, 8378, 5798, 11890, 6952, 9170, 3450, 10267, 11971, 4032,
+      6746, 10618, 783, 11514, 6272, 8738, 3857, 7673, 9807, 2864, 6664, 1908,
+      5273, 15949, 8909, 12950, 4845, 3077, 7452, 12749, 15241, 11269, 7124, 16226,
+      10585, 14170, 5884, 2052, 8212, 3788, 12451, 2421, 7874, 11747, 2024, 14211,
+      4922, 34, 14739, 13102, 2638, 5283, 13350, 9174, 4464, 13763, 5128, 358,
+      7689, 14345, 4095, 15600, 9160, 3651, 13709, 2519, 5136, 3563, 9955, 7593,
+      1224, 11116, 3451, 9718, 12462, 1102, 10034, 13869, 15879, 9564, 7264, 257,
+      10528, 4051, 7616, 15327, 12098, 14208, 8754, 6586, 504, 5743, 3302, 12868,
+      8334, 15426, 13522, 9811, 12716, 2747, 6343, 1697, 5306, 162, 4246, 11548,
+      6255, 874, 7339, 11213, 5209, 2115, 11850, 9284, 948, 10337, 1758, 11935,
+      4762, 15003, 8283, 11515, 16144, 7131, 3603, 8271, 1169, 15973, 10502, 13687,
+      766, 9819, 2606, 15583, 409, 14833, 5995, 13724, 1306, 8294, 13365, 4672,
+      14991, 224, 13981, 5770, 15210, 4783, 14432, 10202, 13502, 3925, 11152, 565,
+      8136, 11519, 14173, 4125, 2537, 8241, 4363, 1386, 6511, 11999, 4005, 15625,
+      11303, 14341, 10328, 5525, 13269, 935, 9500, 6180, 11001, 8299, 3747, 10679,
+      7534, 11649, 1531, 6805, 15470, 2358, 10218, 15784, 12412, 5888, 11211, 7410,
+      1330, 14956, 7852, 10474, 15466, 6694, 508, 15101, 4595, 14181, 6548, 1787,
+      16358, 5700, 7749, 2316, 5067, 11304, 3310, 15473, 5459, 12535, 1215, 10878,
+      5621, 1050, 10435, 4076, 12172, 8970, 14065, 7206, 2392, 5640, 967, 3718,
+      7267, 10815, 13443, 8354, 11835, 14178, 9004, 1907, 10377, 15237, 12833, 3519,
+      15785, 8280, 14752, 4823, 12604, 14207, 8611, 15814, 2575, 797, 6525, 3104,
+      4667, 185, 11106, 14116, 5433, 9298, 1915, 6407, 14748, 4686, 13113, 10948,
+      5429, 8232, 1950, 11163, 15447, 3214, 9439, 2156, 10332, 12915, 2639, 11439,
+      1574, 8133, 12678, 45, 7790, 2419, 6602, 15226, 13422, 1776, 6330, 9369,
+      1204, 14875, 9715, 12959, 2976, 8594, 894, 9766, 5117, 1422, 6708, 15551,
+      3972, 10873, 16254, 2987, 13821, 12085, 2058, 5824, 15149, 4215, 14425, 8371,
+      651, 6152, 11586, 7053, 3532, 1714, 9833, 2667, 12218, 6047, 4319, 12767,
+      1598, 11647, 13445, 8904, 2628, 12780, 7926, 11781, 4433, 8849, 14642, 12529,
+      6926, 1642, 12990, 8340, 2199, 14338, 8785, 6744, 2494, 12888, 15527, 8010,
+      14494, 1783, 4759, 10454, 11792, 14754, 9062, 12170, 15129, 392, 4520, 16237,
+      3569, 7368, 12956, 14828, 5119, 8195, 2512, 6017, 10349, 201, 6863, 2452,
+      7735, 3264, 6636, 5275, 11036, 13901, 10289, 14502, 12369, 8017, 15156, 2877,
+      13092, 7174, 12125, 3711, 11249, 8589, 1518, 7552, 3913, 13310, 9470, 4656,
+      7207, 12315, 5365, 15916, 7750, 4069, 9288, 7016, 13587, 10605, 3126, 6052,
+      12056, 14773, 9824, 5385, 3303, 10428, 15593, 5070, 11088, 13414, 5551, 7551,
+      10934, 15234, 13528, 7302, 12600, 3332, 9597, 520, 8648, 6946, 5024, 7922,
+      738, 4613, 15768, 9393, 410, 10016, 2757, 10833, 12788, 14580, 4245, 1161,
+      9136, 13683, 16373, 5160, 14294, 10276, 952, 9204, 7356, 5356, 3266, 10951,
+      6055, 9937, 548, 14444, 2738, 10802, 5, 3746, 9276, 14985, 4587, 10137,
+      6317, 11245, 3354, 15999, 9408, 4447, 7048, 2916, 6143, 9606, 15607, 89,
+      3650, 6594, 1969, 4936, 8193, 6021, 10372, 2140, 9697, 1312, 6040, 2909,
+      12137, 490, 9392, 14258, 12031, 3965, 13960, 9787, 15526, 11643, 405, 13040,
+      9073, 3902, 7524, 1158, 9556, 5631, 1970, 10030, 4480, 563, 15665, 7899,
+      2482, 15249, 6083, 14328, 11897, 932, 16156, 2686, 10412, 308, 13808, 6391,
+      1095, 12230, 5143, 16338, 621, 4286, 9045, 15826, 4658, 8522, 789, 11823,
+      7201, 8732, 33, 12377, 7006, 3423, 469, 14308, 1755, 4715, 6118, 2631,
+      16181, 8074, 13667, 11833, 14382, 2339, 12679, 14666, 10190, 6749, 13279, 8016,
+      12548, 6626, 13664, 5516, 3425, 9479, 7872, 15078, 10766, 4508, 8185, 119,
+      7173, 3026, 15572, 13360, 2280, 16255, 8263, 14334, 1716, 15672, 5251, 9445,
+      6884, 15392, 5988, 11763, 13839, 856, 7682, 15890, 1100, 13349, 5049, 118,
+      11471, 13864, 814, 11073, 3951, 12457, 7630, 13199, 9342, 13984, 10628, 15798,
+      2873, 12841, 14436, 6815, 12282, 15375, 10941, 4181, 9866, 16167, 7139, 4436,
+      1832, 8661, 12875, 5449, 1566, 4624, 10258, 14872, 1775, 5980, 11816, 2690,
+      15523, 13010, 6893, 11889, 8324, 14260, 5575, 10185, 13507, 117, 9741, 3098,
+      8666, 6556, 11465, 5840, 14959, 8160, 3475, 11312, 8915, 14532, 1924, 10050,
+      6225, 11738, 13806, 1060, 10859, 3548, 14021, 2007, 16026, 4048, 14254, 2885,
+      8274, 15167, 10448, 4103, 12205, 8363, 10357, 140, 11232, 4608, 2078, 5670,
+      3715, 11085, 1174, 8900, 2786, 11508, 1450, 3518, 5027, 1834, 16081, 7454,
+      1076, 12263, 2484, 12951, 6111, 2911, 11713, 13062, 9074, 11405, 6558, 4851,
+      11844, 9886, 44, 4450, 7583, 11634, 2309, 13495, 3948, 12908, 2065, 8311,
+      5195, 10672, 2556, 11915, 3941, 9615, 7148, 14888, 8121, 5699, 9982, 16107,
+      8586, 1272, 5632, 2332, 4627, 7783, 636, 11737, 9511, 1427, 3781, 8625,
+      5072, 598, 8460, 14419, 6538, 1417, 13327, 11107, 15670, 6406, 957, 10905,
+      8165, 13653, 7140, 3421, 8214, 16078, 13665, 5082, 8768, 4062, 698, 16256,
+      3158, 11097, 1577, 4265, 6998, 12250, 5155, 15656, 2092, 13973, 3831, 9134,
+      1657, 13027, 4887, 15186, 2675, 7151, 13121, 3537, 14921, 7731, 2549, 6614,
+      14656, 7538, 12706, 5151, 10773, 13079, 5692, 9874, 1369, 12806, 6307, 9346,
+      16014, 3152, 12946, 14399, 9095, 6643, 14981, 10310, 7776, 15403, 6222, 4071,
+      16003, 5662, 13951, 10787, 14663, 8480, 11678, 4411, 10607, 15519, 5046, 569,
+      7423, 15308, 1616, 5576, 3899, 13999, 602, 8681, 3432, 14649, 6237, 12530,
+      13829, 3654, 10492, 8481, 1082, 7439, 10198, 16152, 3179, 6745, 14619, 5698,
+      8050, 14288, 1975, 12274, 3591, 1674, 12839, 2518, 14151, 11402, 14918, 10142,
+      16195, 12258, 5855, 3968, 7112, 14996, 10874, 13848, 2850, 13084, 7189, 2105,
+      12896, 3614, 5422, 8114, 2965, 10139, 14662, 3389, 16283, 2333, 11948, 5550,
+      9823, 198, 10630, 7202, 1837, 11435, 13957, 5168, 9376, 6571, 12731, 15407,
+      9092, 3535, 11057, 12769, 7340, 10395, 500, 14516, 12091, 6826, 9775, 835,
+      10690, 5541, 11473, 8257, 1452, 4928, 12895, 10236, 1743, 5686, 9328, 3087,
+      7876, 944, 6848, 11929, 15855, 4861, 2281, 7752, 713, 5291, 7195, 1838,
+      3606, 12015, 1615, 13037, 325, 9614, 13430, 11814, 7636, 116, 9104, 7044,
+      2620, 9696, 1420, 13215, 8220, 5977, 9317, 13934, 11084, 8588, 13619, 10191,
+      16011, 2356, 10711, 15219, 7269, 1260, 11166, 9084, 1459, 6569, 16034, 5505,
+      14340, 12142, 4584, 432, 11398, 13444, 9432, 616, 12808, 2954, 10473, 6297,
+      9187, 15248, 7446, 5353, 378, 7067, 3362, 6504, 1544, 3145, 14468, 8943,
+      12499, 5216, 115, 6342, 10120, 16048, 4354, 11619, 10352, 9077, 14933, 419,
+      12631, 4859, 7521, 12281, 6168, 9148, 922, 15291, 12836, 3010, 4331, 12537,
+      14907, 9861, 7828, 2376, 13323, 342, 8161, 2658, 14232, 1737, 6453, 850,
+      4243, 13240, 5641, 7937, 4186, 2303, 16058, 8644, 13546, 4284, 440, 15694,
+      9895, 14184, 8730, 3830, 16110, 11421, 1156, 15233, 10064, 14500, 2368, 8756,
+      3866, 10801, 14578, 11595, 13737, 9730, 15313, 10976, 5902, 15710, 8240, 4482,
+      6879, 2827, 5076, 1824, 9838, 15072, 4324, 12305, 15718, 6137, 3915, 14791,
+      70, 2687, 11952, 3932, 1902, 4643, 6657, 806, 8097, 6355, 4350, 12734,
+      5402, 13704, 2659, 5162, 14927, 8060, 296, 11277, 2925, 9132, 6413, 14903,
+      8776, 1796, 4301, 15363, 11066, 5287, 16284, 485, 13700, 4648, 11692, 9812,
+      4292, 13268, 8850, 11043, 13733, 7995, 10429, 1163, 2517, 15933, 8036, 11939,
+      1738, 8953, 5874, 1165, 15524, 2488, 6291, 10530, 14104, 2165, 9553, 32,
+      4168, 14286, 10937, 4563, 6966, 14489, 9295, 6043, 838, 3641, 6228, 10843,
+      14769, 4108, 11800, 5823, 10423, 7921, 16285, 9426, 14925, 8380, 2935, 15719,
+      10165, 11527, 5735, 3165, 7514, 14668, 6565, 12410, 3042, 6136, 230, 12336,
+      8019, 2792, 12934, 6170, 3818, 11542, 5040, 13872, 512, 8004, 5675, 1339,
+      6518, 2389, 4259, 8555, 13468, 1126, 10002, 14555, 11003, 15638, 8336, 14071,
+      3511, 12697, 2272, 5404, 612, 13584, 11458, 6929, 9973, 16257, 6449, 14447,
+      10082, 15777, 12235, 3382, 11637, 13501, 9195, 1645, 10140, 8231, 15978, 10529,
+      3359, 12300, 9762, 4294, 15438, 1622, 13339, 3687, 7482, 12472, 6122, 8508,
+      1630, 7316, 3793, 8370, 10911, 1348, 3091, 14816, 12341, 1764, 15741, 5121,
+      218, 4225, 15384, 6891, 13400, 9450, 4409, 14013, 3506, 14549, 12435, 8102,
+      3935, 7346, 11992, 4223, 8558, 5997, 15598, 10621, 13286, 7782, 2790, 8606,
+      1227, 11138, 2174, 15910, 8573, 12972, 15373, 1150, 7332, 10083, 15926, 1252,
+      13702, 3861, 12303, 5326, 1863, 10614, 12168, 1448, 6502, 114, 13896, 12546,
+      1229, 11087, 2325, 9213, 4685, 11342, 15506, 6810, 5054, 9949, 14090, 8560,
+      189, 16286, 7228, 12635, 9630, 15667, 3565, 13159, 10282, 14810, 11932, 441,
+      5074, 7361, 3449, 2051, 5854, 11938, 899, 10453, 5765, 6984, 11193, 8728,
+      10240, 7619, 2005, 4905, 12864, 3587, 8674, 862, 7348, 2711, 9326, 14545,
+      4872, 1112, 15612, 3027, 12229, 4110, 398, 7180, 13330, 1860, 5879, 13728,
+      7350, 10437, 5319, 11090, 2597, 15985, 9907, 3334, 11818, 14942, 10180, 13217,
+      5414, 15471, 6803, 8685, 5607, 7729, 2844, 11993, 9427, 12802, 5456, 11532,
+      3373, 6234, 1482, 9945, 7367, 5051, 337, 10154, 12971, 14454, 752, 16205,
+      1523, 12924, 3345, 7015, 1760, 5681, 15983, 12372, 5241, 13539, 7517, 4753,
+      11317, 2311, 4503, 12206, 5562, 2969, 8912, 4835, 7085, 211, 10806, 2845,
+      14092, 6936, 4764, 13175, 9106, 14719, 4653, 8292, 9805, 3910, 16339, 7957,
+      13613, 1170, 10284, 2262, 14866, 758, 7002, 4633, 10926, 9165, 3236, 1848,
+      6141, 2645, 11881, 8834, 4782, 7430, 3352, 9291, 16170, 11246, 12680, 13994,
+      9352, 3763, 7307, 14910, 1380, 13558, 16374, 1189, 14430, 3407, 15505, 10803,
+      7918, 1744, 13554, 11562, 5264, 12753, 368, 6031, 8655, 11080, 6491, 7748,
+      14506, 5984, 11607, 9390, 4552, 14706, 8527, 2429, 12196, 525, 8147, 14126,
+      1142, 4958, 13497, 391, 14042, 6320, 2550, 926, 7831, 11925, 1965, 10656,
+      549, 14528, 10418, 6252, 14359, 2375, 8482, 746, 14720, 11030, 12757, 15093,
+      2323, 11368, 15769, 6585, 2175, 5248, 11045, 9585, 7580, 11221, 4902, 15077,
+      11648, 9419, 515, 10129, 15130, 3521, 9666, 275, 13780, 6631, 10319, 9117,
+      14588, 1735, 12754, 11184, 14992, 8285, 13434, 6160, 9196, 488, 15351, 7774,
+      3505, 10792, 1881, 6883, 15171, 5866, 12881, 1601, 6983, 14658, 4192, 8936,
+      13165, 3545, 11891, 15512, 1594, 5747, 11986, 14834, 10171, 13710, 6852, 19,
+      15549, 1533, 12459, 14051, 6301, 1713, 8590, 4992, 582, 16037, 12815, 4617,
+      9175, 2555, 8026, 4879, 6368, 12223, 8974, 727, 14610, 5848, 9732, 4086,
+      14994, 10629, 7700, 15522, 2285, 14018, 3839, 9731, 1469, 13208, 2393, 15619,
+      6519, 680, 11364, 16314, 6568, 4149, 15346, 9185, 12024, 6937, 10898, 7927,
+      5089, 9344, 12421, 4498, 14239, 9421, 3980, 16206, 12565, 4684, 8570, 883,
+      3921, 7183, 16287, 10135, 4832, 8252, 470, 5592, 8552, 13527, 3253, 9324,
+      13921, 8308, 3554, 5722, 2737, 14621, 644, 8464, 2906, 13826, 3990, 6871,
+      1861, 6235, 11841, 15419, 7911, 3398, 16211, 687, 7623, 13770, 5925, 3393,
+      1618, 9789, 4525, 15874, 11892, 4016, 11273, 2245, 5807, 15906, 12310, 2964,
+      11442, 377, 10516, 5055, 9610, 2859, 12265, 7531, 5620, 10378, 8112, 2779,
+      12914, 14123, 8061, 4886, 1259, 8319, 4451, 14257, 10932, 5894, 7975, 2257,
+      10644, 4182, 14838, 6921, 10900, 8090, 2795, 6395, 12259, 10826, 3561, 13266,
+      11068, 2391, 4622, 6690, 12454, 2831, 15905, 7073, 1576, 3119, 13194, 4226,
+      10305, 12514, 113, 16062, 4815, 10597, 7863, 3582, 12467, 10245, 5036, 3203,
+      9444, 13170, 2121, 6003, 3627, 14916, 2237, 3895, 15397, 1329, 7484, 15932,
+      6071, 2704, 13693, 6435, 9711, 3164, 13509, 15663, 10782, 12294, 1589, 13149,
+      2582, 6928, 15892, 3886, 10536, 6349, 1360, 4546, 11272, 1191, 15054, 12297,
+      13563, 6444, 9964, 12831, 5312, 7622, 14914, 12176, 8475, 13316, 1269, 5482,
+      10763, 1893, 12708, 5243, 3848, 10749, 8462, 15676, 6705, 12558, 2503, 963,
+      7437, 14374, 8602, 13608, 10045, 650, 8563, 5103, 13663, 8813, 3597, 14330,
+      11659, 6020, 15111, 1111, 16187, 1850, 14369, 6428, 9641, 3824, 768, 10716,
+      15996, 11609, 2181, 9239, 3640, 12899, 10075, 4852, 15477, 236, 12255, 3069,
+      13431, 1405, 9845, 14677, 178, 15560, 6837, 9476, 522, 15805, 13731, 10007,
+      3871, 10931, 597, 8938, 13937, 5619, 8465, 1283, 7178, 5497, 8422, 11582,
+      6919, 14884, 919, 8977, 13679, 2049, 7283, 14323, 895, 11139, 7382, 10326,
+      69, 12848, 8360, 9768, 13012, 11254, 3133, 10246, 112, 10915, 8088, 1309,
+      7366, 11185, 1897, 6723, 5083, 9234, 3481, 6163, 13980, 9754, 11722, 1980,
+      12687, 15223, 7981, 12361, 16018, 6728, 10073, 355, 8736, 1987, 4000, 16079,
+      1047, 10980, 2347, 4974, 10425, 3191, 14698, 9159, 4371, 14405, 8413, 9881,
+      15029, 2577, 1119, 11677, 4873, 14121, 7916, 10949, 5705, 3181, 1476, 6436,
+      4448, 12970, 7247, 14768, 1392, 6699, 15699, 2089, 8374, 147, 10686, 5099,
+      9415, 11500, 4500, 321, 11222, 7497, 15115, 6689, 3274, 5780, 13224, 7128,
+      15794, 649, 3009, 13353, 8731, 7181, 9815, 5753, 15343, 4200, 11426, 5488,
+      8647, 4458, 1792, 14353, 5600, 8369, 7249, 1597, 15251, 8227, 12667, 4358,
+      11395, 9947, 16216, 11744, 14501, 3315, 13364, 2023, 9403, 2978, 11903, 4309,
+      5766, 15110, 8639, 12264, 5517, 15804, 4384, 14249, 11530, 5609, 16258, 937,
+      6606, 5399, 14909, 8501, 13405, 5066, 12057, 15134, 5527, 14701, 8256, 13048,
+      1285, 15232, 7594, 11382, 4419, 1014, 14407, 9093, 4991, 139, 9821, 5751,
+      2046, 3685, 7717, 4705, 15692, 10831, 7799, 11849, 6638, 9623, 13610, 138,
+      16235, 7671, 11306, 2313, 6981, 11632, 402, 6441, 12272, 7209, 13344, 9263,
+      303, 10458, 3731, 15296, 13235, 9462, 16137, 10738, 14295, 1935, 9646, 3931,
+      10447, 12061, 4721, 12643, 7129, 13248, 3904, 14002, 2321, 7144, 13514, 15662,
+      5221, 12306, 2028, 12824, 9736, 14318, 1177, 10445, 5286, 8528, 14911, 5969,
+      11626, 1236, 13925, 2135, 8542, 6818, 12711, 2060, 14153, 7369, 11765, 10334,
+      3974, 12883, 3103, 11573, 6188, 5000, 2122, 15540, 6347, 242, 2613, 4924,
+      9540, 779, 15420, 5959, 4507, 14055, 6628, 15729, 10953, 88, 3387, 10025,
+      1402, 8335, 2754, 9125, 1757, 7589, 4519, 10780, 2652, 13802, 1529, 3814,
+      6661, 15618, 1846, 4081, 305, 12415, 2648, 4472, 10056, 13856, 137, 8999,
+      14967, 8018, 5982, 2778, 7444, 13571, 3109, 14336, 10561, 13110, 14817, 11813,
+      3161, 5661, 14225, 1484, 3558, 15402, 5615, 8954, 3849, 6091, 871, 12779,
+      15589, 3346, 13786, 1619, 4255, 15481, 5539, 3328, 16288, 6254, 8939, 1661,
+      4769, 12289, 156, 7393, 3391, 11967, 5626, 16000, 2696, 7997, 645, 10115,
+      3116, 15972, 6381, 8517, 12490, 3392, 8929, 1539, 8253, 2981, 9018, 4817,
+      237, 8131, 3954, 11754, 2349, 12295, 6980, 1822, 3887, 16359, 4814, 12038,
+      10446, 793, 15911, 3507, 9644, 13352, 2945, 16177, 1208, 9269, 15069, 302,
+      13583, 9463, 14379, 7568, 3515, 13630, 7833, 12714, 6424, 11336, 8009, 10527,
+      12346, 619, 10076, 1894, 7924, 12903, 4793, 14127, 6841, 13304, 11780, 6193,
+      15004, 3256, 12041, 14510, 9218, 7412, 11811, 9884, 12797, 2809, 8880, 10510,
+      7147, 9340, 15876, 6356, 11908, 3084, 5289, 12270, 2124, 3705, 12782, 9992,
+      16197, 11509, 4366, 8377, 604, 6177, 9144, 1347, 7075, 13030, 8989, 4899,
+      12517, 8272, 2589, 13086, 11614, 14305, 9599, 4609, 8255, 5764, 10072, 7984,
+      11230, 2062, 10313, 7719, 12611, 2336, 14614, 11631, 6917, 2921, 8409, 5159,
+      15288, 8735, 477, 11409, 6344, 13633, 15165, 5390, 8706, 1767, 10321, 1248,
+      14760, 5448, 10599, 13097, 6298, 15299, 13799, 10650, 14913, 6894, 16360, 8995,
+      13854, 4400, 9764, 14149, 11032, 9198, 7571, 3222, 14557, 5335, 8141, 10835,
+      6230, 847, 4945, 7789, 6145, 12385, 4444, 10734, 7078, 3313, 810, 10380,
+      12050, 9371, 15096, 4036, 2059, 14845, 3577, 1538, 16259, 7415, 13055, 3758,
+      9290, 6332, 16149, 11300, 2098, 3751, 15569, 599, 9883, 13385, 8607, 671,
+      3956, 15959, 5134, 445, 7907, 4874, 11528, 13965, 1964, 3807, 10939, 699,
+      8687, 7304, 16141, 10151, 6414, 15492, 10986, 840, 5506, 1609, 6942, 15107,
+      12029, 4978, 2749, 11072, 14587, 193, 2666, 10565, 14762, 652, 6866, 10285,
+      1239, 7397, 2992, 15065, 10882, 1660, 16124, 5142, 14586, 8918, 13684, 1315,
+      11175, 5223, 8166, 686, 10318, 14945, 13074, 11247, 2295, 13391, 7125, 14402,
+      1519, 9253, 3748, 12954, 11388, 14414, 4751, 11961, 7009, 570, 16103, 4105,
+      10048, 658, 3852, 5725, 1871, 12157, 2764, 6146, 1304, 15514, 18, 8081,
+      2712, 5739, 13249, 332, 9447, 12944, 4088, 1461, 15033, 12342, 9142, 11470,
+      14196, 2189, 8314, 5500, 16102, 11472, 13132, 5830, 1979, 5073, 1016, 10865,
+      8624, 13019, 7113, 4878, 8770, 2553, 5623, 14806, 11771, 2771, 1078, 7757,
+      9361, 5432, 10546, 7652, 4665, 2241, 5388, 6889, 12561, 2164, 10678, 13594,
+      14809, 1211, 16225, 6120, 12613, 15174, 5406, 12890, 14440, 1883, 4132, 13271,
+      554, 8745, 4727, 14272, 8053, 12892, 10403, 2446, 9517, 13373, 16361, 8279,
+      4567, 9770, 15579, 7533, 5878, 11521, 14048, 4463, 15767, 5333, 13239, 322,
+      6737, 12159, 2819, 12929, 17, 3471, 4926, 6813, 14997, 3509, 13892, 12809,
+      5941, 4084, 1505, 9443, 6294, 4188, 10177, 3062, 4984, 10891, 7546, 1105,
+      6211, 2870, 7772, 15446, 3211, 11449, 7843, 2409, 12616, 7405, 11710, 8571,
+      13338, 9792, 4619, 11330, 7780, 10596, 6425, 12376, 15701, 1433, 11554, 14987,
+      6674, 2216, 11445, 13968, 7130, 2627, 15475, 31, 3647, 10091, 13390, 1009,
+      2621, 7953, 4113, 15487, 8704, 14093, 7182, 15966, 5341, 328, 10138, 13726,
+      11608, 14315, 9870, 369, 4903, 13506, 10101, 4395, 14598, 12794, 1723, 14253,
+      12313, 15881, 10626, 14800, 9546, 5978, 8520, 3508, 6853, 9698, 2944, 8358,
+      10606, 1062, 7980, 2727, 10272, 6116, 11601, 7707, 3321, 13838, 7014, 2740,
+      9355, 3761, 15734, 6345, 891, 3953, 6804, 1862, 12828, 6260, 11887, 3795,
+      1914, 9567, 3111, 8642, 1649, 12088, 10126, 8705, 14061, 4142, 9550, 7440,
+      6214, 11696, 15862, 9856, 513, 9157, 7263, 2579, 9799, 15702, 7820, 14333,
+      842, 16238, 12652, 8574, 15231, 12246, 2450, 15820, 9913, 13811, 233, 9341,
+      6013, 13499, 9107, 5149, 14815, 1644, 15995, 2860, 6681, 421, 15390, 13680,
+      2190, 13025, 3673, 4960, 10070, 7111, 3491, 4644, 8788, 16122, 5987, 9756,
+      4491, 8575, 5721, 10633, 7214, 15795, 6256, 8949, 14842, 9943, 1492, 6672,
+      12242, 3176, 9980, 2256, 11870, 14686, 2908, 6221, 1292, 4089, 6770, 15901,
+      8670, 7105, 15221, 11871, 694, 7011, 8920, 3140, 6532, 111, 8149, 2983,
+      1186, 13001, 15294, 1688, 12073, 5617, 13326, 4512, 5938, 9525, 13938, 4347,
+      15643, 9069, 1270, 15258, 9800, 11292, 1725, 12208, 14793, 227, 5177, 11102,
+      14164, 7914, 10511, 14324, 3336, 8765, 724, 13201, 16158, 4797, 12620, 14978,
+      6316, 7837, 3737, 2054, 5861, 14943, 1234, 10769, 13963, 8576, 2422, 12485,
+      4426, 11039, 16049, 4942, 1194, 11162, 2961, 5124, 11769, 7476, 1955, 5682,
+      110, 6789, 13403, 4829, 8432, 3987, 12536, 10715, 2004, 14592, 1063, 11114,
+      6387, 9670, 4459, 10935, 14365, 5301, 8678, 3495, 5789, 9267, 15105, 1205,
+      14009, 8577, 13459, 10737, 993, 12200, 3198, 374, 11169, 13440, 1410, 14488,
+      4862, 1779, 11630, 4217, 12283, 5214, 13885, 11081, 30, 4657, 12988, 5972,
+      7862, 3979, 9194, 15748, 10856, 8030, 12357, 2406, 11200, 1247, 3578, 6171,
+      2718, 16065, 5069, 11482, 9578, 4380, 11668, 13928, 4047, 11103, 4857, 7976,
+      14509, 10993, 618, 14949, 11943, 3323, 6855, 12237, 576, 5002, 12425, 2505,
+      5702, 4236, 16104, 5859, 10233, 7419, 13557, 8654, 2880, 12130, 5634, 986,
+      11656, 15337, 5398, 10253, 8203, 6799, 87, 10632, 2739, 13599, 16239, 10694,
+      11910, 8267, 5345, 15752, 3881, 794, 5809, 7822, 14285, 1820, 6187, 12182,
+      8786, 13841, 6817, 13343, 9692, 3437, 11023, 13753, 9571, 3215, 10367, 778,
+      11821, 7007, 16375, 5483, 3639, 7588, 4418, 13125, 3121, 8115, 13666, 960,
+      7477, 12551, 1419, 10249, 14607, 726, 7614, 10888, 2842, 5808, 1780, 15408,
+      5460, 7227, 14470, 8037, 15747, 3680, 12004, 7746, 12887, 9733, 3095, 14191,
+      437, 7413, 3446, 8841, 16220, 7701, 14527, 861, 11010, 13467, 1788, 12540,
+      5268, 801, 13768, 3864, 5649, 13198, 9563, 14158, 8445, 10848, 13606, 1408,
+      15480, 13370, 5757, 7631, 16260, 6620, 270, 10123, 2653, 4180, 8969, 2307,
+      7821, 14466, 1750, 10862, 7654, 13614, 6655, 14696, 8172, 12993, 646, 8873,
+      3032, 11695, 1895, 4393, 14934, 1527, 15860, 8997, 4706, 7720, 2813, 14186,
+      1355, 11764, 14540, 5204, 9005, 916, 4778, 7143, 521, 3312, 12621, 2031,
+      9129, 13146, 15073, 10355, 3232, 13042, 8100, 43, 15297, 4266, 1931, 8483,
+      373, 15311, 6415, 4068, 15685, 8007, 14751, 6125, 14144, 2572, 1434, 8640,
+      15070, 12203, 10208, 15279, 136, 11987, 5645, 10085, 3757, 15816, 11284, 6816,
+      12063, 4349, 12756, 6498, 16315, 12245, 9854, 8079, 2583, 13180, 9946, 5032,
+      2044, 6642, 9364, 2774, 818, 14979, 8367, 6611, 10757, 15442, 13051, 1797,
+      5440, 10685, 2487, 8867, 15864, 4833, 7132, 8561, 3088, 14581, 8942, 10320,
+      15301, 7715, 2013, 11551, 4194, 353, 7327, 3784, 8305, 2632, 867, 10295,
+      2132, 9257, 12251, 15581, 7320, 13942, 6520, 15791, 246, 9769, 5471, 16383,
+      2310, 10389, 3686, 9422, 1537, 10701, 7137, 14171, 4897, 15832, 6563, 12822,
+      9583, 7166, 3610, 10325, 13720, 1692, 11168, 6229, 4345, 9377, 3255, 7449,
+      15202, 11157, 13005, 9465, 15094, 13677, 10112, 6282, 11484, 4694, 7033, 1145,
+      5361, 9493, 14707, 3636, 10306, 5850, 12785, 14835, 4920, 12178, 7875, 1086,
+      11736, 5154, 1844, 11208, 3557, 9738, 13100, 11067, 483, 6197, 2360, 8580,
+      6659, 15891, 1568, 14674, 8448, 2015, 5039, 2888, 8157, 15687, 2084, 9061,
+      3740, 251, 4555, 14685, 11406, 4085, 868, 11733, 13588, 10578, 4571, 16316,
+      6034, 11347, 5057, 1525, 9229, 2524, 6106, 10251, 14314, 3950, 12257, 6454,
+      3417, 10130, 183, 15198, 10513, 6158, 2088, 6950, 249, 12121, 5078, 15605,
+      6595, 9879, 15051, 12453, 10574, 6658, 14952, 11867, 5113, 13346, 3724, 5669,
+      939, 12618, 10012, 4844, 11335, 3629, 13164, 8331, 4303, 15123, 268, 11819,
+      5242, 15613, 3658, 11930, 1387, 8080, 10591, 536, 5882, 11178, 13184, 86,
+      6788, 14812, 8709, 12873, 15851, 2114, 13877, 12215, 1334, 6129, 3585, 2117,
+      6575, 4585, 1059, 7964, 14423, 2607, 10855, 16207, 12003, 2148, 6860, 11488,
+      1629, 7764, 11092, 3157, 10032, 2076, 14133, 10434, 2714, 13174, 9153, 7391,
+      15461, 5630, 7792, 4330, 13760, 9664, 5180, 14218, 3503, 9528, 4758, 11464,
+      6423, 14102, 9399, 13544, 336, 9919, 5624, 14234, 11613, 7759, 13096, 6627,
+      1494, 9047, 15649, 6028, 8457, 491, 14070, 12348, 8043, 3717, 13547, 15957,
+      11950, 4728, 12501, 8277, 552, 7184, 15335, 1152, 11378, 14298, 5696, 13131,
+      4143, 12216, 15736, 4478, 13488, 3314, 9186, 975, 13017, 2986, 5704, 1703,
+      4914, 13089, 8829, 3028, 8095, 1365, 14780, 8869, 11579, 3520, 1530, 13404,
+      15242, 6821, 908, 11541, 6421, 8832, 14044, 7261, 13260, 2297, 6138, 9514,
+      13748, 2829, 14699, 3829, 15556, 2203, 8242, 4377, 11774, 5489, 3496, 733,
+      7803, 10350, 6443, 4501, 10114, 8247, 15817, 12074, 8926, 11231, 15994, 3678,
+      12292, 537, 8710, 4012, 7709, 13790, 4462, 15678, 9050, 14210, 647, 7049,
+      16022, 5540, 8701, 4271, 6970, 15942, 269, 4456, 12129, 984, 14731, 2919,
+      7055, 15990, 864, 11226, 12918, 7385, 2221, 13142, 3430, 936, 11750, 5943,
+      15053, 3370, 11050, 1093, 4921, 15284, 2760, 9695, 5412, 13862, 7400, 2270,
+      14856, 3564, 7086, 1905, 10174, 68, 8804, 2956, 7190, 774, 15080, 3666,
+      13341, 9808, 4993, 13549, 7586, 2678, 9268, 1906, 7898, 673, 9141, 10885,
+      7858, 14525, 6086, 10635, 7547, 14194, 11574, 9379, 16080, 215, 4167, 13742,
+      15836, 7074, 10684, 2224, 7585, 16180, 6098, 8175, 4528, 9230, 14357, 2959,
+      12758, 1707, 5020, 3090, 10254, 8468, 15032, 25, 11121, 5508, 9156, 7503,
+      11817, 5237, 13807, 16198, 1878, 9259, 15329, 10968, 5003, 12660, 345, 15369,
+      2882, 13689, 5531, 279, 14077, 2694, 5403, 9942, 7244, 15236, 5901, 13395,
+      10026, 376, 6281, 12673, 3025, 5250, 12397, 4178, 9301, 13060, 481, 14946,
+      12209, 5714, 9975, 13970, 2454, 8505, 10220, 12593, 1677, 11742, 8048, 4628,
+      1331, 10564, 15074, 8023, 9948, 16317, 7317, 4165, 12423, 7564, 13428, 6740,
+      8799, 10440, 1258, 14877, 11980, 3057, 10304, 4719, 12220, 9272, 11440, 5226,
+      15483, 12644, 6173, 10363, 14697, 11228, 9542, 6427, 2720, 11693, 1805, 9015,
+      4261, 12337, 15528, 6547, 11454, 13819, 2756, 5386, 1074, 11605, 2334, 16381,
+      3838, 1271, 8187, 2734, 7238, 11383, 6331, 10121, 934, 5417, 12588, 4273,
+      13870, 9536, 11061, 1952, 12260, 1376, 10338, 5873, 15449, 9576, 11325, 16077,
+      901, 4565, 12605, 7319, 3973, 13207, 1875, 13941, 756, 9347, 3149, 10213,
+      7467, 12610, 2493, 6914, 13692, 3342, 8990, 7051, 11520, 1715, 9627, 4176,
+      6963, 8397, 14726, 1553, 13202, 2926, 11544, 1670, 3476, 14548, 10880, 1250,
+      7416, 10212, 14705, 1741, 11588, 2884, 7584, 10963, 1425, 3217, 7983, 11006,
+      6494, 16159, 4651, 5905, 8808, 3827, 13366, 6542, 15756, 3227, 5883, 605,
+      5173, 10977, 2319, 8876, 1414, 9656, 2372, 15740, 3443, 12717, 7039, 4006,
+      7873, 67, 12935, 16027, 1336, 5815, 14524, 2902, 7607, 4373, 14240, 2010,
+      5408, 3952, 1416, 15917, 7893, 14041, 5915, 16382, 10809, 518, 4946, 10265,
+      3697, 16148, 7336, 12624, 15222, 9702, 4763, 8714, 12632, 5212, 15339, 12879,
+      4582, 14637, 2187, 12392, 9161, 3349, 14613, 6748, 66, 5092, 3049, 13658,
+      7224, 16025, 4174, 7973, 568, 3772, 7578, 12420, 6591, 14139, 2183, 8986,
+      16231, 6430, 10353, 4559, 15184, 6832, 11494, 6030, 413, 14175, 4120, 9877,
+      1385, 16318, 11071, 5085, 13072, 7864, 14772, 10791, 12810, 822, 12016, 6536,
+      9042, 4869, 9771, 6996, 15806, 8996, 4980, 8433, 16376, 2254, 6200, 8194,
+      15482, 6461, 13716, 5161, 9191, 13034, 15177, 1125, 3726, 13153, 346, 14562,
+      10639, 15262, 2497, 10001, 8343, 11960, 13767, 9070, 14612, 3671, 12947, 15416,
+      5470, 14571, 4504, 11941, 465, 5706, 16194, 10744, 14291, 9350, 3790, 6687,
+      8159, 10730, 648, 13473, 9459, 1110, 11385, 7887, 13312, 8746, 12648, 5058,
+      10768, 42, 3739, 7353, 2380, 14775, 8101, 14140, 961, 5953, 9490, 3909,
+      1746, 6479, 13860, 109, 11125, 6771, 9901, 657, 10525, 8535, 3710, 15592,
+      7662, 11338, 1793, 10192, 12832, 15486, 8431, 5644, 9096, 2646, 11880, 14095,
+      10796, 13329, 5558, 1811, 9334, 10998, 5687, 12060, 3039, 1084, 12657, 8351,
+      2456, 13059, 1444, 15045, 4711, 8476, 12047, 15002, 5588, 7935, 2342, 14463,
+      887, 3632, 6066, 2096, 16261, 5087, 10410, 3855, 15856, 16, 14262, 12128,
+      4388, 2477, 11664, 13964, 3916, 13000, 11063, 4680, 1507, 10278, 3883, 16289,
+      2053, 6285, 4597, 11969, 7544, 9098, 11345, 3213, 6734, 923, 5253, 14317,
+      174, 4387, 2424, 6890, 11701, 1511, 6592, 10392, 29, 11415, 6232, 8233,
+      13986, 9537, 2073, 4761, 1182, 5919, 11620, 13931, 2660, 15365, 4056, 6277,
+      11924, 16140, 3424, 9951, 420, 15564, 6985, 2315, 14593, 8597, 12402, 9829,
+      13220, 6376, 3281, 8931, 12964, 2225, 11224, 13645, 8393, 12241, 3079, 7650,
+      14564, 2173, 3571, 14010, 5697, 1333, 13401, 4929, 394, 6037, 15224, 7913,
+      2608, 11718, 1018, 14684, 11289, 311, 6704, 4867, 2230, 8763, 14575, 3245,
+      15410, 4050, 448, 14657, 9972, 7683, 15417, 5733, 10583, 3942, 8783, 13505,
+      10641, 2261, 6607, 609, 9441, 12452, 4262, 6701, 10166, 15639, 11884, 9162,
+      3329, 7928, 13844, 2150, 11360, 8265, 5718, 1184, 7903, 13151, 6104, 742,
+      7028, 9434, 108, 14012, 8691, 12564, 615, 7824, 10823, 14535, 9750, 2495,
+      15680, 5112, 1833, 13944, 7930, 12426, 8910, 11294, 6199, 13094, 10693, 15893,
+      4821, 8315, 13979, 4228, 7618, 13372, 1880, 10699, 3897, 7530, 12120, 13436,
+      8610, 15645, 1858, 9813, 5200, 8884, 12978, 7830, 2219, 5044, 7018, 14631,
+      6110, 2996, 11702, 10230, 4306, 6487, 15370, 1017, 5129, 11143, 1428, 11996,
+      7001, 14825, 5198, 678, 15573, 4636, 10041, 15915, 5741, 9337, 12042, 7741,
+      15975, 11198, 6995, 9915, 14267, 11843, 4017, 9331, 4870, 6561, 9978, 3900,
+      5245, 14868, 12843, 9717, 15869, 6975, 785, 10475, 7648, 13182, 8741, 6835,
+      4668, 11558, 3621, 214, 12225, 16109, 7511, 2979, 5749, 15899, 11329, 3802,
+      14583, 1765, 10587, 12885, 8452, 4901, 41, 7089, 14446, 1176, 9593, 6064,
+      14885, 3239, 13424, 10745, 14831, 1940, 9189, 15358, 3076, 12030, 5560, 15303,
+      2823, 5896, 14722, 11857, 3436, 7191, 15, 14067, 10616, 6375, 12739, 9650,
+      4059, 16123, 1636, 3604, 15395, 7801, 1773, 9510, 519, 12567, 2784, 9676,
+      16146, 3218, 9247, 15349, 1011, 14503, 2989, 6615, 10984, 3238, 7481, 12466,
+      350, 11392, 1599, 14718, 10557, 9137, 13729, 1575, 12291, 4592, 9085, 1218,
+      13437, 2112, 11011, 3485, 9281, 13857, 15707, 4325, 9952, 3046, 8084, 10608,
+      7106, 2252, 11568, 1073, 3919, 13568, 1499, 4716, 9149, 2939, 12533, 1823,
+      8578, 2780, 13627, 729, 15800, 13104, 1852, 13899, 10533, 3018, 8286, 1124,
+      3470, 11529, 4473, 12720, 5913, 1391, 15991, 2595, 13719, 1751, 14522, 9515,
+      6969, 4982, 851, 11959, 9067, 1140, 7359, 13371, 8530, 6269, 15965, 1081,
+      2741, 13616, 9790, 12574, 5643, 11286, 4199, 12707, 7502, 1687, 9254, 3978,
+      6731, 10217, 5114, 11187, 8148, 13739, 4080, 10631, 7118, 9891, 4381, 8957,
+      1488, 12658, 4948, 8264, 3608, 915, 15056, 2602, 5793, 10523, 7399, 13354,
+      9851, 5320, 3277, 14344, 6213, 10892, 14721, 1325, 5810, 12432, 6971, 4947,
+      11666, 5962, 10122, 329, 15088, 5325, 14199, 4332, 16319, 7087, 5610, 3364,
+      12443, 155, 4144, 10927, 7702, 15305, 13024, 7469, 15837, 5451, 8110, 14512,
+      7047, 2539, 7967, 5668, 40, 15968, 12326, 3766, 14421, 5909, 8951, 13138,
+      7177, 10759, 15455, 6446, 235, 14930, 4304, 6296, 16362, 5169, 10464, 7453,
+      11053, 3372, 8373, 7082, 1471, 6287, 15268, 12387, 5701, 13847, 8902, 15214,
+      2886, 9575, 11403, 5217, 10312, 8546, 5917, 12882, 2099, 13889, 10036, 15325,
+      4378, 12676, 9988, 2791, 5001, 11830, 3473, 7728, 15034, 6212, 3698, 15345,
+      2470, 8643, 15928, 866, 10481, 4957, 15571, 12557, 667, 16012, 2753, 14143,
+      1282, 6220, 1995, 13210, 1075, 15648, 2253, 13975, 6049, 15845, 9539, 13543,
+      11907, 7473, 8792, 11207, 1255, 14128, 4927, 2536, 637, 12139, 8511, 12860,
+      3924, 7704, 4959, 11798, 8751, 811, 14389, 2529, 8024, 16057, 4479, 12967,
+      8123, 1549, 9386, 10682, 2872, 13195, 10018, 15324, 7435, 6007, 15789, 8634,
+      2142, 5584, 510, 3714, 9688, 11743, 285, 4632, 12703, 1106, 10307, 13605,
+      11450, 6698, 1451, 9280, 12763, 317, 15272, 3035, 5115, 8638, 2605, 12279,
+      10020, 13457, 8135, 10924, 588, 12845, 6411, 1545, 14284, 5536, 12187, 16214,
+      13449, 9636, 4156, 7603, 10501, 1781, 7372, 65, 12086, 4097, 7797, 13093,
+      626, 15743, 4123, 8014, 11016, 3523, 6067, 7972, 2474, 14523, 5552, 15383,
+      338, 14064, 9669, 4766, 11379, 8719, 1685, 10566, 4800, 13383, 6927, 3584,
+      14416, 11775, 6308, 2496, 7818, 11700, 4383, 7281, 9935, 15867, 9318, 7737,
+      11786, 5344, 12909, 7362, 11298, 3938, 1027, 5633, 2698, 15943, 4700, 14594,
+      6688, 12059, 9166, 15189, 10818, 6992, 16173, 1313, 10361, 15629, 2326, 7142,
+      15195, 4364, 10860, 9723, 13298, 1721, 9025, 2772, 11688, 6800, 13540, 1097,
+      8443, 4910, 681, 8753, 2090, 13367, 11510, 3263, 9985, 14467, 11396, 6501,
+      2457, 13902, 8894, 16213, 11173, 6468, 15132, 2972, 8641, 4224, 13894, 5282,
+      2475, 10498, 7897, 11731, 13927, 639, 14461, 7425, 3547, 5596, 2278, 14404,
+      9274, 3123, 15459, 9893, 2581, 8961, 107, 4549, 2805, 11995, 455, 14241,
+      2706, 16073, 5100, 10061, 14079, 6278, 14841, 1580, 6870, 11726, 2651, 15203,
+      1104, 14457, 12167, 276, 11290, 7026, 1624, 8769, 10714, 6515, 2011, 13335,
+      749, 14313, 12329, 7384, 386, 11793, 2226, 9910, 7974, 212, 8740, 14107,
+      5296, 8984, 13331, 250, 11979, 4894, 2950, 14912, 3816, 8811, 457, 10494,
+      2830, 7958, 15047, 10162, 6612, 484, 12543, 3765, 8059, 10, 3456, 6238,
+      13846, 4305, 2693, 5986, 8911, 216, 13098, 9366, 3162, 13590, 6195, 175,
+      4021, 7102, 11027, 14025, 4904, 15781, 3759, 6023, 15211, 11174, 13903, 3868,
+      10399, 4775, 1233, 6685, 13706, 4227, 8556, 15151, 12422, 4072, 6121, 1620,
+      3205, 9452, 4876, 12960, 1937, 15295, 10777, 8234, 16363, 6644, 4237, 1868,
+      6262, 9466, 4513, 10938, 16030, 1053, 11599, 7034, 4082, 11882, 7890, 4785,
+      12743, 15128, 11183, 7474, 15559, 8515, 5351, 11258, 9130, 6599, 12566, 3410,
+      8262, 1913, 10570, 3593, 9498, 14132, 5512, 10260, 7335, 9059, 4856, 13382,
+      9604, 4115, 13793, 12175, 3727, 15863, 8303, 10526, 6915, 4061, 5710, 16364,
+      8458, 14056, 6328, 15668, 4541, 13741, 3220, 10943, 1091, 14998, 10366, 3513,
+      14486, 7024, 12963, 869, 11136, 6772, 16002, 4794, 14117, 12335, 1984, 11546,
+      14282, 8978, 10703, 1949, 9927, 16045, 12695, 8425, 898, 9679, 14747, 11629,
+      13740, 3767, 11314, 5465, 1436, 11981, 8417, 15658, 12403, 14570, 5679, 600,
+      9637, 2293, 10876, 12516, 7626, 2209, 6598, 12332, 16046, 7901, 14827, 12630,
+      795, 7577, 1981, 10098, 684, 7923, 10505, 14219, 7479, 12458, 372, 6192,
+      9849, 7383, 606, 13120, 3452, 12066, 14714, 10170, 15849, 13006, 1353, 6081,
+      8536, 13069, 9651, 15622, 6019, 1877, 13561, 634, 6948, 3617, 5828, 10113,
+      1998, 6675, 14672, 1495, 3828, 13478, 1207, 11434, 15493, 5381, 12857, 16262,
+      4610, 8392, 85, 13080, 4039, 2355, 15113, 6482, 2984, 16076, 8021, 6048,
+      1199, 12645, 5122, 2971, 15541, 9389, 2396, 10259, 3350, 5215, 11093, 1548,
+      12656, 6029, 9616, 16340, 3959, 6670, 2040, 5820, 8739, 1516, 10406, 5914,
+      14342, 2491, 9950, 1522, 6315, 9146, 4467, 7314, 3351, 4995, 13225, 6107,
+      13985, 4810, 11017, 2423, 5591, 12478, 7116, 1733, 5063, 7906, 14611, 9873,
+      16131, 6920, 2596, 5132, 1261, 8692, 3207, 15385, 7711, 13205, 8807, 4,
+      4211, 14415, 9060, 928, 6046, 2731, 9171, 5179, 10622, 16320, 5819, 13480,
+      4822, 15550, 2511, 11681, 4169, 15746, 8352, 14691, 3786, 11953, 4989, 6370,
+      1698, 9329, 538, 5364, 8129, 2685, 12002, 14995, 2437, 5056, 3433, 0,
+      14047, 9091, 10637, 14813, 8487, 12089, 1008, 13914, 12919, 4014, 9773, 12150,
+      7884, 14980, 4880, 7448, 472, 8828, 2763, 7234, 11253, 2141, 12022, 6765,
+      15725, 10922, 1526, 8463, 10589, 712, 11365, 2689, 9969, 7490, 14360, 229,
+      11707, 13755, 1144, 12762, 14635, 931, 9477, 7553, 2785, 11447, 1370, 7324,
+      11728, 8454, 12790, 15647, 11262, 4310, 16290, 9279, 4570, 12048, 13759, 8302,
+      15391, 64, 13021, 16263, 1320, 8146, 15578, 2940, 7691, 1483, 6873, 13538,
+      15722, 3403, 10975, 8649, 15253, 2733, 6244, 988, 4517, 10625, 14141, 11496,
+      9839, 6417, 12053, 10514, 1294, 5492, 3289, 16113, 9836, 5247, 11719, 3490,
+      14103, 11332, 1827, 12095, 3676, 8864, 2938, 11468, 7098, 12563, 9029, 843,
+      5740, 10157, 1831, 10942, 13394, 2535, 15655, 10270, 14394, 7107, 13794, 3646,
+      11280, 6785, 4114, 9242, 13781, 7883, 10839, 12653, 7487, 4412, 2967, 5583,
+      2108, 15923, 9215, 4963, 8261, 725, 16264, 2975, 5800, 10239, 2192, 10784,
+      14148, 12227, 9853, 947, 13661, 5795, 14665, 3034, 9446, 5186, 11946, 14085,
+      5673, 14604, 4804, 13188, 15164, 4201, 11170, 6208, 8559, 4650, 7328, 5979,
+      8042, 11694, 3796, 15179, 13909, 8554, 5252, 13196, 2567, 14279, 4784, 468,
+      7390, 12314, 2341, 8068, 282, 7295, 3478, 5315, 11466, 3216, 10431, 5514,
+      9793, 11968, 704, 11176, 9467, 15152, 4166, 10232, 8993, 1108, 4574, 12820,
+      632, 10275, 13569, 8605, 12623, 1962, 7678, 3745, 15147, 1866, 4589, 13562,
+      7077, 14616, 11625, 6735, 13525, 1429, 15576, 8108, 9803, 4428, 15659, 7158,
+      14062, 354, 14670, 9547, 1454, 3538, 6353, 15075, 12835, 2901, 7145, 5203,
+      782, 7573, 8722, 3997, 11497, 2369, 8382, 12685, 1188, 14193, 10443, 362,
+      6507, 1762, 15302, 5811, 1547, 16291, 11569, 13117, 10044, 6787, 3293, 11720,
+      5457, 10955, 6938, 13018, 266, 8603, 15944, 6128, 3002, 4671, 6393, 15058,
+      3416, 10483, 8742, 1035, 13717, 7646, 560, 3462, 7354, 2066, 9374, 6892,
+      833, 9086, 2119, 13216, 3283, 15321, 10981, 2750, 15760, 4714, 12983, 6181,
+      426, 3464, 15552, 9991, 734, 6283, 10590, 3117, 9678, 14145, 3778, 12874,
+      15330, 9804, 13252, 2021, 14790, 6526, 7853, 14381, 2656, 13725, 5933, 3771,
+      13013, 375, 12107, 2047, 7742, 14233, 6676, 16365, 5712, 11563, 7136, 3188,
+      15502, 6092, 9303, 540, 13247, 8216, 16321, 2821, 9244, 4119, 1774, 8421,
+      2781, 10842, 7092, 379, 13206, 6481, 1418, 8438, 5357, 12812, 6540, 4561,
+      15969, 13745, 11142, 4355, 7825, 13946, 11618, 16221, 9548, 14569, 12352, 983,
+      5834, 16083, 4614, 9810, 15283, 7660, 5292, 16171, 12430, 9924, 4137, 11838,
+      8222, 9607, 6531, 826, 4634, 14138, 1556, 15344, 2357, 14083, 9140, 4791,
+      14530, 11799, 3937, 13157, 7965, 15542, 1926, 12475, 7529, 4848, 15902, 6426,
+      4107, 12502, 16366, 9999, 13026, 11486, 15757, 3431, 12134, 5464, 16222, 7779,
+      10167, 1399, 12596, 8981, 135, 10548, 2107, 8853, 10368, 12111, 7079, 4392,
+      14695, 8947, 12408, 15400, 6008, 1026, 6637, 10814, 4988, 1472, 6215, 10750,
+      9200, 819, 12483, 1607, 4481, 7192, 9081, 14870, 5327, 8328, 6337, 15490,
+      5093, 10451, 2934, 9499, 1992, 4127, 14326, 254, 11204, 4252, 14932, 12033,
+      5452, 10150, 6652, 262, 12619, 10303, 15142, 5940, 12384, 4356, 14724, 5485,
+      2995, 11047, 13670, 10134, 2665, 11014, 1968, 8040, 10292, 9, 8493, 2033,
+      9906, 545, 3922, 6108, 2106, 4586, 6702, 2974, 13039, 10609, 63, 6310,
+      3234, 1873, 11724, 3770, 2359, 8627, 14024, 505, 3527, 14507, 2557, 15153,
+      8065, 12353, 10469, 7170, 11580, 3777, 1352, 10404, 2799, 6706, 1502, 9456,
+      631, 11475, 10281, 8632, 703, 12958, 2019, 11598, 10155, 1761, 5548, 8734,
+      4470, 8, 5975, 8416, 14223, 10316, 3926, 509, 14771, 6763, 4212, 14400,
+      5544, 13930, 7219, 16203, 4981, 14099, 1222, 11362, 2905, 7522, 1628, 4193,
+      11534, 7978, 15121, 2055, 8581, 12147, 16071, 4026, 14003, 4967, 15847, 8620,
+      10919, 15340, 1190, 10535, 2229, 14222, 10907, 3301, 12869, 267, 11859, 13958,
+      7373, 12411, 8778, 5394, 9748, 13526, 1475, 7306, 2378, 3964, 11370, 14213,
+      5118, 7612, 765, 13393, 9339, 1663, 10158, 12612, 8781, 15257, 638, 4621,
+      15900, 9055, 14894, 12087, 3187, 5375, 13212, 15755, 6473, 14869, 8803, 13049,
+      11040, 14020, 10241, 15538, 9075, 7365, 14781, 12441, 8541, 13567, 9359, 6042,
+      14636, 7062, 5091, 10141, 13572, 5360, 11019, 9121, 3819, 5821, 62, 8868,
+      12851, 15012, 5989, 15763, 7814, 13656, 10946, 4553, 14433, 6862, 3875, 5522,
+      14783, 9370, 3716, 14035, 8158, 15194, 6925, 2618, 15006, 10478, 13773, 1332,
+      2601, 7045, 12965, 9246, 5708, 11834, 2294, 10006, 8164, 3623, 12493, 875,
+      3078, 8258, 5916, 9483, 15951, 13293, 5678, 13949, 2463, 9294, 13118, 4275,
+      14209, 7058, 479, 8418, 2814, 6794, 11565, 3589, 6224, 12165, 3065, 7655,
+      12672, 4370, 951, 9412, 7290, 14905, 4416, 8398, 885, 14988, 2318, 15686,
+      6867, 2997, 8376, 11013, 14538, 12927, 1178, 8656, 3074, 15865, 11119, 3330,
+      5272, 16004, 7669, 3804, 1996, 6050, 7845, 12025, 6827, 3907, 845, 5936,
+      14307, 7278, 10829, 4787, 2941, 11927, 1665, 7245, 3482, 265, 7956, 1748,
+      5096, 3665, 1623, 11190, 4341, 15465, 543, 10723, 12900, 1155, 15609, 2235,
+      12398, 7558, 653, 12871, 2074, 16044, 13713, 4496, 6639, 567, 8469, 11965,
+      1814, 5455, 15450, 8361, 12709, 2290, 16240, 13300, 2912, 11343, 7338, 5405,
+      962, 3335, 11108, 13397, 1595, 7280, 9238, 5075, 11516, 14664, 1611, 10952,
+      3056, 13671, 7298, 15998, 1343, 10990, 6447, 9373, 13592, 15286, 1957, 12640,
+      4713, 3, 8562, 10248, 16115, 5276, 330, 10055, 3024, 11328, 5515, 12702,
+      10003, 13376, 1932, 9572, 184, 13621, 5037, 16202, 9691, 6780, 11895, 15914,
+      5559, 1947, 11009, 6153, 3376, 9835, 4605, 10837, 1118, 12527, 16060, 4827,
+      6248, 9173, 15562, 7040, 12333, 1898, 6434, 8928, 13817, 106, 11639, 14229,
+      9582, 12850, 3134, 14159, 1734, 11305, 7736, 12690, 2292, 9380, 1617, 12508,
+      8207, 10390, 5350, 13795, 9305, 15118, 5880, 12058, 13334, 14339, 9909, 5658,
+      2304, 6695, 7847, 2894, 4506, 8070, 11219, 6245, 8845, 4240, 15441, 6828,
+      10676, 9381, 7569, 2726,
+  };
+  return kRanks;
+}
+
+} // namespace Dither
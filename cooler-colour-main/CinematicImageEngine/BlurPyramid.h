@@ -0,0 +1,220 @@
+#pragma once
+
+#include "PlanarImage.h"
+#include "Utils.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Gaussian pyramid of one blur source, shared by its consumers.
+ *
+ * Level 0 is the source itself (not copied); level k is level k - 1 box
+ * downsampled 2x, built on first use and kept. A blur of radius r runs on
+ * the coarsest level where its residual radius is still kMinResidual
+ * pixels or more, then comes back through a chain of 2x bilinear
+ * upsamples. Each level cuts the residual passes by 4x, so a 200 px glow
+ * costs little more than a 10 px one. Every consumer of one source (a set
+ * of radii, octaves or channels) reads the same levels, and each request
+ * pays only for its residual blur and upsample.
+ *
+ * The residual radius is picked so that, with the variance the downsample
+ * and upsample chains add, the blur's variance matches the full-size
+ * filter at the same radius. The result therefore matches a direct
+ * gaussianBlur, apart from the interpolation's ripple. Draft runs
+ * one level coarser (at least half resolution) with a single box pass, as
+ * the Draft tier always has for the blur-based stages.
+ *
+ * Only the first `channels` planes of the source take part, so a mono
+ * source can sit in one plane of a 3-plane buffer. Levels still to be built
+ * read the source, so it must not change until the last request, which may
+ * blur it in place.
+ */
+template <class T> class BlurPyramidT {
+public:
+  static constexpr int kMinResidual = 8; // Blur radius at the chosen level
+  static constexpr int kMaxLevel = 5;    // 32x
+
+  BlurPyramidT(const PlanarImageT<T> &src, int channels,
+               const Utils::Scheduler *sched = nullptr)
+      : _src(&src), _channels(std::min(channels, src.channels())),
+        _sched(sched) {
+    _levels.reserve(kMaxLevel); // level() hands out references
+  }
+
+  // Level a blur of radius r runs on
+  static int levelFor(int r, bool draft) {
+    int k = 0;
+    while (k < kMaxLevel && (r >> (k + 1)) >= kMinResidual)
+      ++k;
+    return draft ? std::min(kMaxLevel, k + 1) : k;
+  }
+
+  // Pixels a blur of radius r reads around an output pixel: the combined
+  // radius of its box passes at its level, plus a pixel of that level for
+  // the downsample chain and one for the upsample. Final's three boxes
+  // each carry the full sigma (see variance()), so they reach about 2.4 r;
+  // Draft's single box stays within r.
+  static int reach(int r, bool draft) {
+    const int k = levelFor(r, draft);
+    return (support(residual(r, k, draft), draft) + 2) << k;
+  }
+
+  // Combined radius of filter()'s box passes at radius r
+  static int support(int r, bool draft) {
+    if (draft)
+      return Utils::fastBoxRadius(r);
+    int radii[3];
+    Utils::boxRadiiForGaussian(std::max(0.1f, (float)r / 2.0f), radii);
+    return radii[0] + radii[1] + radii[2];
+  }
+
+  // Variance per axis of filter() at radius r, in pixels^2: the sum over
+  // its box passes of (K^2 - 1) / 12 for a box of K taps. (The 3-pass
+  // Gaussian's boxes come out wider than sigma r / 2, and the pyramid has
+  // to match what the full-size filter really does.)
+  static float variance(int r, bool draft) {
+    if (r < 1)
+      return 0.0f;
+    auto box = [](int br) { return (float)(4 * br * (br + 1)) / 12.0f; };
+    if (draft)
+      return box(Utils::fastBoxRadius(r));
+    int radii[3];
+    Utils::boxRadiiForGaussian(std::max(0.1f, (float)r / 2.0f), radii);
+    return box(radii[0]) + box(radii[1]) + box(radii[2]);
+  }
+
+  // Radius at level k whose blur, taken down and back up, has the variance
+  // of filter() at radius r at level 0. A 2x box downsample from pitch p
+  // adds p^2 / 4 and a 2x bilinear upsample back to it 3p^2 / 4, so k
+  // levels down and up add (4^k - 1) / 3.
+  static int residual(int r, int k, bool draft) {
+    if (k == 0)
+      return r;
+    const float f2 = (float)(1 << (2 * k));
+    const float target = variance(r, draft) - (f2 - 1.0f) / 3.0f;
+    int best = 1;
+    float bestErr = std::abs(variance(1, draft) * f2 - target);
+    for (int rc = 2; rc <= (r >> k) + 2; ++rc) {
+      const float err = std::abs(variance(rc, draft) * f2 - target);
+      if (err < bestErr) {
+        best = rc;
+        bestErr = err;
+      }
+    }
+    return best;
+  }
+
+  // One plane, at full size: 3-pass Gaussian, or one box pass for Draft.
+  // Same aliasing rules as Utils::gaussianBlur (src == dst allowed).
+  static void filter(const T *src, T *dst, T *tmp, int w, int h, int r,
+                     bool draft, const Utils::Scheduler *sched = nullptr) {
+    if (draft)
+      Utils::fastBoxBlur(src, dst, tmp, w, h, r, sched);
+    else
+      Utils::gaussianBlur(src, dst, tmp, w, h, r, sched);
+  }
+
+  int channels() const { return _channels; }
+
+  // Level k, built (with the levels below it) on first use
+  const PlanarImageT<T> &level(int k) {
+    if (k == 0)
+      return *_src;
+    while ((int)_levels.size() < k) {
+      const PlanarImageT<T> &prev = _levels.empty() ? *_src : _levels.back();
+      PlanarImageT<T> next((prev.width() + 1) / 2, (prev.height() + 1) / 2,
+                           _channels);
+      Utils::downsample2x(prev, next, _sched);
+      _levels.push_back(std::move(next));
+    }
+    return _levels[k - 1];
+  }
+
+  // Blur of radius r left at its level in out (sized here); returns the
+  // level
+  int blurCoarse(int r, bool draft, PlanarImageT<T> &out) {
+    const int k = levelFor(r, draft);
+    blurAt(r, k, draft, out);
+    return k;
+  }
+
+  // Blur of radius r at level k (finer or coarser than its own) in out
+  void blurAt(int r, int k, bool draft, PlanarImageT<T> &out) {
+    const PlanarImageT<T> &src = level(k);
+    out.allocate(src.width(), src.height(), _channels);
+    PlanarImageT<T> tmp(src.width(), src.height(), _channels);
+    filterPlanes(src, out, tmp, residual(r, k, draft), draft);
+  }
+
+  // Bring an image at level k back to level 0 through the 2x bilinear
+  // chain, into dst's planes from `plane` on. dst is the source's size (it
+  // may be the source once no level is still to be read).
+  void upsample(const PlanarImageT<T> &coarse, int k, PlanarImageT<T> &dst,
+                int plane = 0) {
+    PlanarImageT<T> bufs[2];
+    const PlanarImageT<T> *from = &coarse;
+    for (int l = k - 1; l > 0; --l) {
+      PlanarImageT<T> &to = bufs[l & 1];
+      to.allocate(level(l).width(), level(l).height(), _channels);
+      Utils::upsample2xBilinear(*from, to, _sched);
+      from = &to;
+    }
+    if (k > 0)
+      upsampleInto(*from, dst, plane);
+  }
+
+  // Blur of radius r at full size into dst's planes from `plane` on (may
+  // be the source itself, as its last request); tmp is scratch of the
+  // source's size
+  void blur(int r, bool draft, PlanarImageT<T> &dst, PlanarImageT<T> &tmp,
+            int plane = 0) {
+    const int k = levelFor(r, draft);
+    if (k == 0) {
+      filterPlanes(*_src, dst, tmp, r, draft, plane);
+      return;
+    }
+    PlanarImageT<T> coarse;
+    blurCoarse(r, draft, coarse);
+    upsample(coarse, k, dst, plane);
+  }
+
+private:
+  void filterPlanes(const PlanarImageT<T> &src, PlanarImageT<T> &dst,
+                    PlanarImageT<T> &tmp, int r, bool draft,
+                    int plane = 0) const {
+    Utils::parallelFor(_sched, _channels, [&](int c) {
+      filter(src.plane(c), dst.plane(plane + c), tmp.plane(c), src.width(),
+             src.height(), r, draft, _sched);
+    });
+  }
+
+  // Last step of the chain, over our planes of dst only
+  void upsampleInto(const PlanarImageT<T> &src, PlanarImageT<T> &dst,
+                    int plane) const {
+    Utils::parallelFor(_sched, _channels, [&](int c) {
+      Utils::upsample2xBilinear(src.plane(c), dst.plane(plane + c),
+                                dst.width(), dst.height(), _sched);
+    });
+  }
+
+  const PlanarImageT<T> *_src;
+  int _channels;
+  const Utils::Scheduler *_sched;
+  std::vector<PlanarImageT<T>> _levels; // 1..n
+};
+
+template <class T> constexpr int BlurPyramidT<T>::kMinResidual;
+template <class T> constexpr int BlurPyramidT<T>::kMaxLevel;
+
+typedef BlurPyramidT<float> BlurPyramid;
+typedef BlurPyramidT<uint16_t> BlurPyramidHalf; // binary16 levels
+
+// Blur the first `channels` planes of img in place at radius r through a
+// pyramid of its own; tmp is scratch of img's size
+template <class T>
+inline void pyramidBlur(PlanarImageT<T> &img, PlanarImageT<T> &tmp, int r,
+                        bool draft, int channels,
+                        const Utils::Scheduler *sched = nullptr) {
+  BlurPyramidT<T>(img, channels, sched).blur(r, draft, img, tmp);
+}
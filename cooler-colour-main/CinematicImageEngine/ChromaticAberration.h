@@ -3,34 +3,252 @@
 #include "Utils.h"
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CIE_CA_AVX2 1
+#endif
 
 namespace ChromaticAberration {
 
+enum Mode { eClassic = 0, eSpectral = 1 };
+
 struct Params {
   bool enable;
   double amount;  // 0..1, strength of the radial shift
   double centerX; // -1..1, offset from frame center
   double centerY; // -1..1, offset from frame center
+  int mode;       // Mode: R/B shift, or a spread over wavelength bins
+  int bins;       // Spectral: 3..8 wavelength samples
+};
+
+// ============================================================================
+// Radial shift
+//
+// A sample is taken at (x, y) + t * (sx, sy) * dist, where (sx, sy) is the
+// pixel's offset from the centre, dist its distance and t the radial scale
+// of what is sampled: +1 for R, -1 for B in Classic mode, one value per
+// wavelength bin between them in Spectral mode. The column and row terms
+// are tabled once per call, so a pixel costs one sqrt plus its samples.
+// ============================================================================
+
+// Extra pixels on each side a window needs from the source
+struct Margins {
+  double x1, y1, x2, y2;
 };
 
-// Sample a single channel from the buffer at UV coordinates
-inline float sampleChannel(const float *src, float su, float sv, float imgW,
-                           float imgH, float rodX1, float rodY1, int bufX1,
-                           int bufY1, int w, int h, int channel) {
-  float px = (su * imgW + rodX1) - (float)bufX1;
-  float py = (sv * imgH + rodY1) - (float)bufY1;
-  int ix = std::max(0, std::min((int)px, w - 1));
-  int iy = std::max(0, std::min((int)py, h - 1));
-  return src[(iy * w + ix) * 4 + channel];
+// Margins for the window [x1, x2) x [y1, y2), in the RoD's coordinates. The
+// shift grows with the distance from the centre and is monotonic along
+// each axis, so the samples of the window's corners bound all of them.
+inline Margins margins(const Params &params, double rodX1, double rodY1,
+                       double imgW, double imgH, double x1, double y1,
+                       double x2, double y2) {
+  Margins m = {0.0, 0.0, 0.0, 0.0};
+  if (!params.enable || params.amount <= 0.0 || imgW <= 0.0 || imgH <= 0.0)
+    return m;
+  const double cx = 0.5 + params.centerX * 0.5;
+  const double cy = 0.5 + params.centerY * 0.5;
+  const double strength = params.amount * 0.02;
+  for (double x : {x1, x2}) {
+    for (double y : {y1, y2}) {
+      const double du = (x - rodX1) / imgW - cx;
+      const double dv = (y - rodY1) / imgH - cy;
+      const double dist = std::sqrt(du * du + dv * dv);
+      // |t| <= 1 for every mode, so the sample moves at most this far
+      const double sx = std::abs(du * dist * strength * imgW);
+      const double sy = std::abs(dv * dist * strength * imgH);
+      m.x1 = std::max(m.x1, x1 - (x - sx));
+      m.x2 = std::max(m.x2, (x + sx) - x2);
+      m.y1 = std::max(m.y1, y1 - (y - sy));
+      m.y2 = std::max(m.y2, (y + sy) - y2);
+    }
+  }
+  // One more for the far tap of the bilinear sample
+  m.x1 = std::ceil(m.x1) + 1.0;
+  m.y1 = std::ceil(m.y1) + 1.0;
+  m.x2 = std::ceil(m.x2) + 1.0;
+  m.y2 = std::ceil(m.y2) + 1.0;
+  return m;
 }
 
-// Apply chromatic aberration by radially shifting R and B channels.
-inline void process(const float *__restrict__ src, float *__restrict__ dst,
-                    int w, int h, float rodX1, float rodY1, float imgW,
-                    float imgH, int bufX1, int bufY1, const Params &params) {
+// Bilinear taps of a w x h buffer at pixel (x, y) shifted by (sx, sy),
+// between pixel centres and clamped to the buffer. The shift is split into
+// whole pixels and a fraction before it meets x and y: the fraction then
+// does not depend on where the pixel sits in the buffer, so a tile and the
+// full frame weigh the same taps.
+struct Taps {
+  size_t i00, i01, i10, i11;
+  float fx, fy;
+};
+
+inline Taps taps(int w, int h, int x, int y, float sx, float sy) {
+  const float wx = std::floor(sx), wy = std::floor(sy);
+  int x0 = x + (int)wx, y0 = y + (int)wy;
+  float fx = sx - wx, fy = sy - wy;
+  if (x0 < 0 || x0 >= w - 1) {
+    x0 = std::min(std::max(x0, 0), w - 1);
+    fx = 0.0f;
+  }
+  if (y0 < 0 || y0 >= h - 1) {
+    y0 = std::min(std::max(y0, 0), h - 1);
+    fy = 0.0f;
+  }
+  const int x1 = std::min(x0 + 1, w - 1), y1 = std::min(y0 + 1, h - 1);
+  Taps t;
+  t.i00 = (size_t)y0 * w + x0;
+  t.i01 = (size_t)y0 * w + x1;
+  t.i10 = (size_t)y1 * w + x0;
+  t.i11 = (size_t)y1 * w + x1;
+  t.fx = fx;
+  t.fy = fy;
+  return t;
+}
+
+inline float fetch(const float *plane, const Taps &t) {
+  const float top = plane[t.i00] + t.fx * (plane[t.i01] - plane[t.i00]);
+  const float bottom = plane[t.i10] + t.fx * (plane[t.i11] - plane[t.i10]);
+  return top + t.fy * (bottom - top);
+}
+
+inline float sampleBilinear(const float *plane, int w, int h, int x, int y,
+                            float sx, float sy) {
+  return fetch(plane, taps(w, h, x, y, sx, sy));
+}
+
+#if defined(CIE_CA_AVX2)
+// taps / fetch for 8 positions at once, through gathers
+struct Taps8 {
+  __m256i i00, i01, i10, i11;
+  __m256 fx, fy;
+};
+
+// One axis of taps8: whole-pixel tap and fraction of x + s, clamped to
+// [0, n - 1] with no fraction at or past either edge
+inline void axis8(__m256i x, __m256 s, int n, __m256i &i0, __m256 &f) {
+  const __m256 whole = _mm256_floor_ps(s);
+  i0 = _mm256_add_epi32(x, _mm256_cvtps_epi32(whole));
+  f = _mm256_sub_ps(s, whole);
+  const __m256i last = _mm256_set1_epi32(n - 1);
+  const __m256i out = _mm256_or_si256(
+      _mm256_cmpgt_epi32(_mm256_setzero_si256(), i0),
+      _mm256_cmpgt_epi32(i0, _mm256_sub_epi32(last, _mm256_set1_epi32(1))));
+  f = _mm256_andnot_ps(_mm256_castsi256_ps(out), f);
+  i0 = _mm256_min_epi32(_mm256_max_epi32(i0, _mm256_setzero_si256()), last);
+}
+
+inline Taps8 taps8(int w, int h, __m256i x, __m256i y, __m256 sx,
+                   __m256 sy) {
+  Taps8 t;
+  __m256i x0, y0;
+  axis8(x, sx, w, x0, t.fx);
+  axis8(y, sy, h, y0, t.fy);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i x1 =
+      _mm256_min_epi32(_mm256_add_epi32(x0, one), _mm256_set1_epi32(w - 1));
+  const __m256i y1 =
+      _mm256_min_epi32(_mm256_add_epi32(y0, one), _mm256_set1_epi32(h - 1));
+  const __m256i r0 = _mm256_mullo_epi32(y0, _mm256_set1_epi32(w));
+  const __m256i r1 = _mm256_mullo_epi32(y1, _mm256_set1_epi32(w));
+  t.i00 = _mm256_add_epi32(r0, x0);
+  t.i01 = _mm256_add_epi32(r0, x1);
+  t.i10 = _mm256_add_epi32(r1, x0);
+  t.i11 = _mm256_add_epi32(r1, x1);
+  return t;
+}
+
+inline __m256 fetch8(const float *plane, const Taps8 &t) {
+  const __m256 a = _mm256_i32gather_ps(plane, t.i00, 4);
+  const __m256 b = _mm256_i32gather_ps(plane, t.i01, 4);
+  const __m256 c = _mm256_i32gather_ps(plane, t.i10, 4);
+  const __m256 d = _mm256_i32gather_ps(plane, t.i11, 4);
+  const __m256 top = _mm256_add_ps(a, _mm256_mul_ps(t.fx, _mm256_sub_ps(b, a)));
+  const __m256 bottom =
+      _mm256_add_ps(c, _mm256_mul_ps(t.fx, _mm256_sub_ps(d, c)));
+  return _mm256_add_ps(top, _mm256_mul_ps(t.fy, _mm256_sub_ps(bottom, top)));
+}
+#endif
+
+// ============================================================================
+// Spectral split
+//
+// Bin b stands for a wavelength lambda_b spread evenly over 400..700 nm and
+// is sampled at radial scale t_b = (lambda_b - 550) / 150, so red bins move
+// out like Classic's R and blue ones in like its B. A bin's share of the
+// sampled colour is dot(resp_b, rgb), with resp_b the RGB response of its
+// wavelength, and it comes back as recon_b * share. recon is resp through
+// the inverse of sum(resp_b resp_b^T), so with no shift the bins add back
+// to the pixel exactly, whatever their count.
+// ============================================================================
+
+static constexpr int kMaxBins = 8;
+
+struct Spectrum {
+  int bins;
+  float t[kMaxBins];
+  float resp[kMaxBins][3];
+  float recon[kMaxBins][3];
+};
+
+inline Spectrum spectrum(int bins) {
+  Spectrum s;
+  s.bins = std::min(std::max(bins, 3), kMaxBins);
+  // Smooth R, G and B responses over wavelength (peak nm, width nm)
+  const double peak[3] = {600.0, 545.0, 450.0};
+  const double width[3] = {45.0, 40.0, 30.0};
+  double a[3][3] = {};
+  for (int b = 0; b < s.bins; ++b) {
+    const double lambda = 400.0 + 300.0 * (b + 0.5) / s.bins;
+    s.t[b] = (float)((lambda - 550.0) / 150.0);
+    for (int c = 0; c < 3; ++c) {
+      const double z = (lambda - peak[c]) / width[c];
+      s.resp[b][c] = (float)std::exp(-0.5 * z * z);
+    }
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j)
+        a[i][j] += (double)s.resp[b][i] * s.resp[b][j];
+  }
+  // Inverse of the 3x3 Gram matrix by cofactors
+  double inv[3][3];
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      inv[j][i] = a[(i + 1) % 3][(j + 1) % 3] * a[(i + 2) % 3][(j + 2) % 3] -
+                  a[(i + 1) % 3][(j + 2) % 3] * a[(i + 2) % 3][(j + 1) % 3];
+  const double det =
+      a[0][0] * inv[0][0] + a[0][1] * inv[1][0] + a[0][2] * inv[2][0];
+  for (int b = 0; b < s.bins; ++b)
+    for (int c = 0; c < 3; ++c)
+      s.recon[b][c] = (float)((inv[c][0] * s.resp[b][0] +
+                               inv[c][1] * s.resp[b][1] +
+                               inv[c][2] * s.resp[b][2]) /
+                              det);
+  return s;
+}
+
+// Apply chromatic aberration by radially shifting src into dst, over the
+// window [winX1, winX2) x [winY1, winY2) of the buffer only: CA is the last
+// spatial stage, and only the output window is read after it. Classic
+// moves R and B and leaves G unwritten; Spectral writes all three. src and
+// dst must NOT alias. Rows are split across sched, 8 pixels at a time with
+// AVX2.
+inline void process(const PlanarImage &src, PlanarImage &dst, float rodX1,
+                    float rodY1, float imgW, float imgH, int bufX1, int bufY1,
+                    int winX1, int winY1, int winX2, int winY2,
+                    const Params &params,
+                    const Utils::Scheduler *sched = nullptr) {
+  const int w = src.width();
+  const int h = src.height();
+  const int n = winX2 - winX1;
+  if (n <= 0 || winY2 <= winY1)
+    return;
+  const bool spectral = params.mode == eSpectral;
   if (!params.enable || params.amount <= 0.0) {
-    if (src != dst)
-      std::memcpy(dst, src, (size_t)w * h * 4 * sizeof(float));
+    for (int y = winY1; y < winY2; ++y)
+      for (int c = 0; c < 3; ++c)
+        if (spectral || c != 1)
+          std::memcpy(dst.row(c, y) + winX1, src.row(c, y) + winX1,
+                      n * sizeof(float));
     return;
   }
 
@@ -40,32 +258,96 @@ inline void process(const float *__restrict__ src, float *__restrict__ dst,
   const float invW = 1.0f / std::max(1.0f, imgW);
   const float invH = 1.0f / std::max(1.0f, imgH);
 
-  for (int y = 0; y < h; ++y) {
-    for (int x = 0; x < w; ++x) {
-      float u = ((float)(bufX1 + x) - rodX1) * invW;
-      float v = ((float)(bufY1 + y) - rodY1) * invH;
-
-      float du = u - cx;
-      float dv = v - cy;
-      float dist = std::sqrt(du * du + dv * dv);
-
-      float shiftR = dist * strength;
-      float shiftB = -dist * strength;
-
-      float uR = u + du * shiftR;
-      float vR = v + dv * shiftR;
-      float uB = u + du * shiftB;
-      float vB = v + dv * shiftB;
-
-      int idx = (y * w + x) * 4;
-      dst[idx + 0] = sampleChannel(src, uR, vR, imgW, imgH, rodX1, rodY1, bufX1,
-                                   bufY1, w, h, 0);
-      dst[idx + 1] = src[idx + 1];
-      dst[idx + 2] = sampleChannel(src, uB, vB, imgW, imgH, rodX1, rodY1, bufX1,
-                                   bufY1, w, h, 2);
-      dst[idx + 3] = src[idx + 3];
-    }
+  // Column terms: squared offset from the centre (frame units) and the
+  // shift per unit of distance (buffer pixels)
+  std::vector<float> du2(n), shiftX(n);
+  for (int i = 0; i < n; ++i) {
+    const float du = ((float)(bufX1 + winX1 + i) - rodX1) * invW - cx;
+    du2[i] = du * du;
+    shiftX[i] = du * strength * imgW;
   }
+
+  const Spectrum spec = spectrum(spectral ? params.bins : 3);
+  const float *in[3] = {src.plane(0), src.plane(1), src.plane(2)};
+  const int rows = 64;
+  const int nRows = winY2 - winY1;
+  Utils::parallelFor(sched, (nRows + rows - 1) / rows, [&](int chunk) {
+    const int yEnd = std::min(winY2, winY1 + (chunk + 1) * rows);
+    for (int y = winY1 + chunk * rows; y < yEnd; ++y) {
+      const float dv = ((float)(bufY1 + y) - rodY1) * invH - cy;
+      const float dv2 = dv * dv;
+      const float shiftY = dv * strength * imgH;
+      float *out[3];
+      for (int c = 0; c < 3; ++c)
+        out[c] = dst.row(c, y) + winX1;
+      int i = 0;
+#if defined(CIE_CA_AVX2)
+      const __m256 vDv2 = _mm256_set1_ps(dv2);
+      const __m256 vShiftY = _mm256_set1_ps(shiftY);
+      const __m256i vY = _mm256_set1_epi32(y);
+      const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      const __m256 neg = _mm256_set1_ps(-0.0f);
+      for (; i + 8 <= n; i += 8) {
+        const __m256 dist = _mm256_sqrt_ps(
+            _mm256_add_ps(_mm256_loadu_ps(du2.data() + i), vDv2));
+        const __m256 sx = _mm256_mul_ps(_mm256_loadu_ps(shiftX.data() + i),
+                                        dist);
+        const __m256 sy = _mm256_mul_ps(vShiftY, dist);
+        const __m256i x =
+            _mm256_add_epi32(_mm256_set1_epi32(winX1 + i), lane);
+        if (!spectral) {
+          const Taps8 r = taps8(w, h, x, vY, sx, sy);
+          const Taps8 b = taps8(w, h, x, vY, _mm256_xor_ps(sx, neg),
+                                _mm256_xor_ps(sy, neg));
+          _mm256_storeu_ps(out[0] + i, fetch8(in[0], r));
+          _mm256_storeu_ps(out[2] + i, fetch8(in[2], b));
+          continue;
+        }
+        __m256 acc[3] = {_mm256_setzero_ps(), _mm256_setzero_ps(),
+                         _mm256_setzero_ps()};
+        for (int bin = 0; bin < spec.bins; ++bin) {
+          const __m256 t = _mm256_set1_ps(spec.t[bin]);
+          const Taps8 tp = taps8(w, h, x, vY, _mm256_mul_ps(t, sx),
+                                 _mm256_mul_ps(t, sy));
+          __m256 share = _mm256_setzero_ps();
+          for (int c = 0; c < 3; ++c)
+            share = _mm256_add_ps(
+                share, _mm256_mul_ps(_mm256_set1_ps(spec.resp[bin][c]),
+                                     fetch8(in[c], tp)));
+          for (int c = 0; c < 3; ++c)
+            acc[c] = _mm256_add_ps(
+                acc[c],
+                _mm256_mul_ps(_mm256_set1_ps(spec.recon[bin][c]), share));
+        }
+        for (int c = 0; c < 3; ++c)
+          _mm256_storeu_ps(out[c] + i, acc[c]);
+      }
+#endif
+      for (; i < n; ++i) {
+        const float dist = std::sqrt(du2[i] + dv2);
+        const float sx = shiftX[i] * dist;
+        const float sy = shiftY * dist;
+        const int x = winX1 + i;
+        if (!spectral) {
+          out[0][i] = sampleBilinear(in[0], w, h, x, y, sx, sy);
+          out[2][i] = sampleBilinear(in[2], w, h, x, y, -sx, -sy);
+          continue;
+        }
+        float acc[3] = {0.0f, 0.0f, 0.0f};
+        for (int bin = 0; bin < spec.bins; ++bin) {
+          const float t = spec.t[bin];
+          const Taps tp = taps(w, h, x, y, t * sx, t * sy);
+          float share = 0.0f;
+          for (int c = 0; c < 3; ++c)
+            share += spec.resp[bin][c] * fetch(in[c], tp);
+          for (int c = 0; c < 3; ++c)
+            acc[c] += spec.recon[bin][c] * share;
+        }
+        for (int c = 0; c < 3; ++c)
+          out[c][i] = acc[c];
+      }
+    }
+  });
 }
 
 } // namespace ChromaticAberration
@@ -0,0 +1,925 @@
+// cie_render — headless batch renderer for image sequences.
+//
+// Runs the same Pipeline as the OFX plugin on PFM or raw float/half frames,
+// with parameters from a JSON file keyed by the plugin's parameter names.
+// Several frames are rendered concurrently and each frame is split into
+// strips, all on one shared ThreadPool. A reader thread decodes ahead and a
+// writer thread encodes behind so disk I/O overlaps compute.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Half.h"
+#include "Pipeline.h"
+#include "ThreadPool.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Parameters
+////////////////////////////////////////////////////////////////////////////////
+
+// Defaults mirror CinematicPluginFactory::describeInContext. Booleans and
+// choices are stored as numbers (false = 0, first option = 0).
+static const std::pair<const char *, double> kParamDefaults[] = {
+    // 1. CIT
+    {"EnableCIT", 1.0},
+    {"CITExposure", 0.0},
+    {"CITChromaCeiling", 1.0},
+    {"CITWhiteBias", 0.0},
+    {"CITTemperature", 0.0},
+    {"CITTint", 0.0},
+    {"CITGlobalSat", 1.0},
+    // 2. PCR
+    {"EnablePCR", 1.0},
+    {"PCRAmount", 0.0},
+    {"PCRShadowCoolBias", 0.0},
+    {"PCRMidtoneColorFocus", 0.0},
+    {"PCRHighlightWarmth", 0.0},
+    {"PCRHighlightCompression", 0.0},
+    {"PCRPreset", 0.0},
+    {"PCRCrossProcess", 0.0},
+    // 3. Tonal
+    {"EnableTonal", 1.0},
+    {"TonalContrast", 1.0},
+    {"TonalPivot", 0.18},
+    {"TonalStrength", 1.0},
+    {"TonalBlackFloor", 0.0},
+    {"TonalHighContrast", 1.0},
+    {"TonalSoftClip", 0.0},
+    // 4. Energy
+    {"EnableEnergy", 0.0},
+    {"EnergyDensity", 1.0},
+    {"EnergySeparation", 0.0},
+    {"EnergyHighRollOff", 0.0},
+    {"EnergyShadowBias", 0.0},
+    {"EnergyVibrance", 1.0},
+    // 5. HLP
+    {"EnableHLP", 0.0},
+    {"HLPThreshold", 1.0},
+    {"HLPRolloff", 0.5},
+    {"HLPPreserveColor", 0.0},
+    // 6. Split
+    {"EnableSplit", 0.0},
+    {"SplitStrength", 0.0},
+    {"SplitShadowHue", 0.0},
+    {"SplitHighlightHue", 0.0},
+    {"SplitBalance", 0.0},
+    {"SplitMidtoneHue", 0.0},
+    {"SplitMidtoneSat", 0.0},
+    // 7. Grain
+    {"EnableGrain", 0.0},
+    {"GrainType", 0.0},
+    {"GrainModel", 0.0},
+    {"GrainAmount", 0.0},
+    {"GrainSize", 0.5},
+    {"GrainShadowWeight", 0.5},
+    {"GrainMidWeight", 0.5},
+    {"GrainHighlightWeight", 0.5},
+    {"GrainChromatic", 0.0},
+    {"GrainTemporalSpeed", 0.5},
+    // 8. Dither
+    {"EnableDither", 0.0},
+    {"DitherAmount", 0.5},
+    {"DitherType", 0.0},
+    {"DitherAnimate", 1.0},
+    // Spatial
+    {"EnableMist", 0.0},
+    {"MistAmount", 0.0},
+    {"MistThreshold", 0.5},
+    {"MistSoftness", 0.5},
+    {"MistDepthBias", 0.0},
+    {"MistWarmth", 0.0},
+    {"EnableBlur", 0.0},
+    {"BlurRadius", 4.0},
+    {"BlurStrength", 0.5},
+    {"BlurShadowAmt", 0.3},
+    {"BlurHighlightAmt", 0.8},
+    {"BlurTonalSoft", 0.5},
+    {"BlurSat", 1.0},
+    {"EnableGlow", 0.0},
+    {"GlowAmount", 0.0},
+    {"GlowThreshold", 0.8},
+    {"GlowKnee", 0.5},
+    {"GlowRadius", 10.0},
+    {"GlowFidelity", 0.5},
+    {"GlowWarmth", 0.0},
+    {"GlowMode", 0.0},
+    {"BloomOctaves", 6.0},
+    {"BloomFalloff", 0.6},
+    {"BloomTint", 0.0},
+    {"EnableSharp", 0.0},
+    {"SharpType", 0.0},
+    {"SharpAmount", 0.0},
+    {"SharpRadius", 1.0},
+    {"SharpDetail", 0.5},
+    {"SharpEdgeProt", 0.0},
+    {"SharpNoiseSupp", 0.0},
+    {"SharpShadowProt", 0.0},
+    {"SharpHighProt", 0.0},
+    {"EnableHalo", 0.0},
+    {"HaloAmount", 0.0},
+    {"HaloThreshold", 0.8},
+    {"HaloKnee", 0.5},
+    {"HaloWarmth", 0.0},
+    {"HaloRadius", 10.0},
+    {"HaloSat", 1.0},
+    {"HaloMode", 0.0},
+    {"HaloSpreadR", 3.0},
+    {"HaloSpreadG", 1.5},
+    {"HaloSpreadB", 0.5},
+    {"EnableVignette", 0.0},
+    {"VignetteType", 0.0},
+    {"VignetteAmount", 0.0},
+    {"VignetteInvert", 0.0},
+    {"VignetteSize", 0.5},
+    {"VignetteRoundness", 0.5},
+    {"VignetteSoftness", 0.5},
+    {"VignetteDefocus", 0.0},
+    {"VignetteDefocusSoft", 0.0},
+    {"VignetteCenterX", 0.0},
+    {"VignetteCenterY", 0.0},
+    {"VignetteTintR", 0.0},
+    {"VignetteTintG", 0.0},
+    {"VignetteTintB", 0.0},
+    {"EnableStreak", 0.0},
+    {"StreakAmount", 0.0},
+    {"StreakThreshold", 0.8},
+    {"StreakLength", 0.5},
+    {"StreakTint", 0.0},
+    {"StreakPoints", 0.0},
+    {"StreakAngle", 0.0},
+    {"StreakLength2", 0.5},
+    {"StreakTint2", 0.0},
+    {"StreakLength3", 0.5},
+    {"StreakTint3", 0.0},
+    {"StreakLength4", 0.5},
+    {"StreakTint4", 0.0},
+    {"EnableCA", 0.0},
+    {"CAAmount", 0.0},
+    {"CACenterX", 0.0},
+    {"CACenterY", 0.0},
+    {"CAMode", 0.0},
+    {"CABins", 5.0},
+    // Performance (cache settings are plugin-only and ignored here)
+    {"QualityMode", (double)eQualityNormal},
+    {"CacheBudget", 0.0},
+    {"DiskCache", 0.0},
+    {"HalfSources", 0.0},
+};
+
+typedef std::map<std::string, double> ParamValues;
+
+// Mirrors CinematicPlugin::render()
+static void applyParams(Pipeline &p, const ParamValues &v) {
+  auto get = [&](const char *name) { return v.at(name); };
+  auto on = [&](const char *name) { return v.at(name) != 0.0; };
+  auto choice = [&](const char *name) { return (int)v.at(name); };
+
+  p.cit.enable = on("EnableCIT");
+  p.cit.exposureTrim = get("CITExposure");
+  p.cit.chromaCeiling = get("CITChromaCeiling");
+  p.cit.whiteBias = get("CITWhiteBias");
+  p.cit.temperature = get("CITTemperature");
+  p.cit.tint = get("CITTint");
+  p.cit.globalSaturation = get("CITGlobalSat");
+
+  p.pcr.enable = on("EnablePCR");
+  p.pcr.amount = get("PCRAmount");
+  p.pcr.shadowCoolBias = get("PCRShadowCoolBias");
+  p.pcr.midtoneColorFocus = get("PCRMidtoneColorFocus");
+  p.pcr.highlightWarmth = get("PCRHighlightWarmth");
+  p.pcr.highlightCompression = get("PCRHighlightCompression");
+  p.pcr.preset = choice("PCRPreset");
+  p.pcr.crossProcess = on("PCRCrossProcess");
+
+  p.tonal.contrast = get("TonalContrast");
+  p.tonal.pivot = get("TonalPivot");
+  p.tonal.strength = on("EnableTonal") ? get("TonalStrength") : 0.0;
+  p.tonal.blackFloor = get("TonalBlackFloor");
+  p.tonal.highlightContrast = get("TonalHighContrast");
+  p.tonal.softClip = get("TonalSoftClip");
+
+  p.energy.enable = on("EnableEnergy");
+  p.energy.density = get("EnergyDensity");
+  p.energy.separation = get("EnergySeparation");
+  p.energy.highlightRollOff = get("EnergyHighRollOff");
+  p.energy.shadowBias = get("EnergyShadowBias");
+  p.energy.vibrance = get("EnergyVibrance");
+
+  p.hlp.threshold = on("EnableHLP") ? get("HLPThreshold") : 100.0;
+  p.hlp.rolloff = get("HLPRolloff");
+  p.hlp.preserveColor = on("HLPPreserveColor");
+
+  p.split.enable = on("EnableSplit");
+  p.split.strength = (float)get("SplitStrength");
+  p.split.shadowHue = (float)get("SplitShadowHue");
+  p.split.highlightHue = (float)get("SplitHighlightHue");
+  p.split.balance = (float)get("SplitBalance");
+  p.split.midtoneHue = (float)get("SplitMidtoneHue");
+  p.split.midtoneSaturation = (float)get("SplitMidtoneSat");
+  if (p.split.enable)
+    SplitToning::precomputeVectors(p.split);
+
+  p.grain.enable = on("EnableGrain");
+  p.grain.grainType = choice("GrainType");
+  p.grain.model = choice("GrainModel");
+  p.grain.amount = (float)get("GrainAmount");
+  p.grain.size = (float)get("GrainSize");
+  p.grain.shadowWeight = (float)get("GrainShadowWeight");
+  p.grain.midWeight = (float)get("GrainMidWeight");
+  p.grain.highlightWeight = (float)get("GrainHighlightWeight");
+  p.grain.chromatic = on("GrainChromatic");
+  p.grain.temporalSpeed = (float)get("GrainTemporalSpeed");
+
+  p.dither.enable = on("EnableDither");
+  p.dither.amount = get("DitherAmount");
+  p.dither.type = choice("DitherType");
+  p.dither.animate = on("DitherAnimate");
+
+  p.mist.enable = on("EnableMist");
+  p.mist.strength = get("MistAmount");
+  p.mist.threshold = get("MistThreshold");
+  p.mist.softness = get("MistSoftness");
+  p.mist.depthBias = get("MistDepthBias");
+  p.mist.colorBias = get("MistWarmth");
+
+  p.blur.enable = on("EnableBlur");
+  p.blur.blurRadius = get("BlurRadius");
+  p.blur.strength = get("BlurStrength");
+  p.blur.shadowAmt = get("BlurShadowAmt");
+  p.blur.highlightAmt = get("BlurHighlightAmt");
+  p.blur.tonalSoftness = get("BlurTonalSoft");
+  p.blur.saturation = get("BlurSat");
+
+  p.glow.enable = on("EnableGlow");
+  p.glow.amount = get("GlowAmount");
+  p.glow.threshold = get("GlowThreshold");
+  p.glow.knee = get("GlowKnee");
+  p.glow.radius = get("GlowRadius");
+  p.glow.colorFidelity = get("GlowFidelity");
+  p.glow.warmth = get("GlowWarmth");
+  p.glow.mode = choice("GlowMode");
+  p.glow.octaves = (int)get("BloomOctaves");
+  p.glow.falloff = get("BloomFalloff");
+  p.glow.tailTint = get("BloomTint");
+
+  p.sharp.enable = on("EnableSharp");
+  p.sharp.type = choice("SharpType");
+  p.sharp.amount = get("SharpAmount");
+  p.sharp.radius = get("SharpRadius");
+  p.sharp.detailAmount = get("SharpDetail");
+  p.sharp.edgeProtection = get("SharpEdgeProt");
+  p.sharp.noiseSuppression = get("SharpNoiseSupp");
+  p.sharp.shadowProtection = get("SharpShadowProt");
+  p.sharp.highlightProtection = get("SharpHighProt");
+
+  p.halo.enable = on("EnableHalo");
+  p.halo.amount = get("HaloAmount");
+  p.halo.threshold = get("HaloThreshold");
+  p.halo.knee = get("HaloKnee");
+  p.halo.warmth = get("HaloWarmth");
+  p.halo.radius = get("HaloRadius");
+  p.halo.saturation = get("HaloSat");
+  p.halo.mode = choice("HaloMode");
+  p.halo.spread[0] = get("HaloSpreadR");
+  p.halo.spread[1] = get("HaloSpreadG");
+  p.halo.spread[2] = get("HaloSpreadB");
+
+  p.streak.enable = on("EnableStreak");
+  p.streak.amount = get("StreakAmount");
+  p.streak.threshold = get("StreakThreshold");
+  p.streak.length = get("StreakLength");
+  p.streak.tint = get("StreakTint");
+  p.streak.points = choice("StreakPoints");
+  p.streak.angle = get("StreakAngle");
+  p.streak.armLength[0] = get("StreakLength2");
+  p.streak.armTint[0] = get("StreakTint2");
+  p.streak.armLength[1] = get("StreakLength3");
+  p.streak.armTint[1] = get("StreakTint3");
+  p.streak.armLength[2] = get("StreakLength4");
+  p.streak.armTint[2] = get("StreakTint4");
+
+  p.ca.enable = on("EnableCA");
+  p.ca.amount = get("CAAmount");
+  p.ca.centerX = get("CACenterX");
+  p.ca.centerY = get("CACenterY");
+  p.ca.mode = choice("CAMode");
+  p.ca.bins = (int)get("CABins");
+
+  p.vig.enable = on("EnableVignette");
+  p.vig.type = choice("VignetteType");
+  p.vig.amount = get("VignetteAmount");
+  p.vig.invert = on("VignetteInvert");
+  p.vig.size = get("VignetteSize");
+  p.vig.roundness = get("VignetteRoundness");
+  p.vig.edgeSoftness = get("VignetteSoftness");
+  p.vig.defocusAmount = get("VignetteDefocus");
+  p.vig.defocusSoftness = get("VignetteDefocusSoft");
+  p.vig.centerX = get("VignetteCenterX");
+  p.vig.centerY = get("VignetteCenterY");
+  p.vig.tintR = get("VignetteTintR");
+  p.vig.tintG = get("VignetteTintG");
+  p.vig.tintB = get("VignetteTintB");
+
+  // No host hints offline, so Normal renders exactly
+  const int quality = choice("QualityMode");
+  p.setQuality(quality == eQualityDraft ? eQualityDraft : eQualityFinal);
+  p.setHalfSources(on("HalfSources"));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Minimal JSON reader
+////////////////////////////////////////////////////////////////////////////////
+
+// Accepts one object whose members are numbers, booleans or nested objects.
+// Nested objects are flattened, so parameters may be grouped by module:
+//   { "Glow": { "EnableGlow": true, "GlowAmount": 0.4 }, "QualityMode": 2 }
+class JsonReader {
+public:
+  explicit JsonReader(const std::string &text) : _s(text), _pos(0) {}
+
+  bool parse(ParamValues &out, std::string &error) {
+    skipSpace();
+    if (!parseObject(out))
+      return fail(error);
+    skipSpace();
+    if (_pos != _s.size()) {
+      _error = "trailing characters";
+      return fail(error);
+    }
+    return true;
+  }
+
+private:
+  bool fail(std::string &error) {
+    char where[48];
+    std::snprintf(where, sizeof(where), " at offset %zu", _pos);
+    error = _error + where;
+    return false;
+  }
+
+  void skipSpace() {
+    while (_pos < _s.size() &&
+           (_s[_pos] == ' ' || _s[_pos] == '\t' || _s[_pos] == '\n' ||
+            _s[_pos] == '\r'))
+      ++_pos;
+  }
+
+  bool expect(char c) {
+    skipSpace();
+    if (_pos < _s.size() && _s[_pos] == c) {
+      ++_pos;
+      return true;
+    }
+    _error = std::string("expected '") + c + "'";
+    return false;
+  }
+
+  bool parseString(std::string &out) {
+    if (!expect('"'))
+      return false;
+    out.clear();
+    while (_pos < _s.size() && _s[_pos] != '"') {
+      if (_s[_pos] == '\\' && _pos + 1 < _s.size())
+        ++_pos;
+      out += _s[_pos++];
+    }
+    return expect('"');
+  }
+
+  bool parseObject(ParamValues &out) {
+    if (!expect('{'))
+      return false;
+    skipSpace();
+    if (_pos < _s.size() && _s[_pos] == '}') {
+      ++_pos;
+      return true;
+    }
+    for (;;) {
+      std::string key;
+      if (!parseString(key) || !expect(':'))
+        return false;
+      skipSpace();
+      if (_pos < _s.size() && _s[_pos] == '{') {
+        if (!parseObject(out))
+          return false;
+      } else {
+        double value;
+        if (!parseValue(value))
+          return false;
+        out[key] = value;
+      }
+      skipSpace();
+      if (_pos < _s.size() && _s[_pos] == ',') {
+        ++_pos;
+        continue;
+      }
+      return expect('}');
+    }
+  }
+
+  bool parseValue(double &out) {
+    if (_s.compare(_pos, 4, "true") == 0) {
+      _pos += 4;
+      out = 1.0;
+      return true;
+    }
+    if (_s.compare(_pos, 5, "false") == 0) {
+      _pos += 5;
+      out = 0.0;
+      return true;
+    }
+    const char *begin = _s.c_str() + _pos;
+    char *end = nullptr;
+    out = std::strtod(begin, &end);
+    if (end == begin) {
+      _error = "expected a number, true, false or an object";
+      return false;
+    }
+    _pos += (size_t)(end - begin);
+    return true;
+  }
+
+  const std::string &_s;
+  size_t _pos;
+  std::string _error;
+};
+
+static bool loadParams(const std::string &path, ParamValues &values) {
+  for (const auto &d : kParamDefaults)
+    values[d.first] = d.second;
+  if (path.empty())
+    return true;
+
+  FILE *f = std::fopen(path.c_str(), "rb");
+  if (!f) {
+    std::fprintf(stderr, "cie_render: cannot open %s\n", path.c_str());
+    return false;
+  }
+  std::string text;
+  char buf[4096];
+  size_t n;
+  while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0)
+    text.append(buf, n);
+  std::fclose(f);
+
+  ParamValues parsed;
+  std::string error;
+  if (!JsonReader(text).parse(parsed, error)) {
+    std::fprintf(stderr, "cie_render: %s: %s\n", path.c_str(), error.c_str());
+    return false;
+  }
+  for (const auto &kv : parsed) {
+    if (!values.count(kv.first)) {
+      std::fprintf(stderr, "cie_render: %s: unknown parameter '%s'\n",
+                   path.c_str(), kv.first.c_str());
+      return false;
+    }
+    values[kv.first] = kv.second;
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Image I/O
+////////////////////////////////////////////////////////////////////////////////
+
+enum FileFormat { eFormatPFM, eFormatRawFloat, eFormatRawHalf };
+
+struct RawLayout {
+  int width = 0;
+  int height = 0;
+  int channels = 4; // 3 = RGB, 4 = RGBA
+};
+
+// Frame buffers are RGBA float, bottom row first (OFX orientation)
+struct Frame {
+  int number = 0;
+  int width = 0;
+  int height = 0;
+  std::vector<float> pixels;
+};
+
+static bool endsWith(const std::string &s, const char *suffix) {
+  const size_t n = std::strlen(suffix);
+  return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+static FileFormat formatFor(const std::string &path) {
+  if (endsWith(path, ".pfm") || endsWith(path, ".PFM"))
+    return eFormatPFM;
+  if (endsWith(path, ".f16") || endsWith(path, ".half"))
+    return eFormatRawHalf;
+  return eFormatRawFloat;
+}
+
+static std::string framePath(const std::string &pattern, int frame) {
+  char buf[4096];
+  std::snprintf(buf, sizeof(buf), pattern.c_str(), frame);
+  return buf;
+}
+
+static bool readPFM(FILE *f, Frame &frame) {
+  char magic[3] = {0};
+  int w = 0, h = 0;
+  double scale = 0.0;
+  if (std::fscanf(f, "%2s %d %d %lf", magic, &w, &h, &scale) != 4 ||
+      std::fgetc(f) == EOF || w <= 0 || h <= 0)
+    return false;
+  int channels;
+  if (std::strcmp(magic, "PF") == 0)
+    channels = 3;
+  else if (std::strcmp(magic, "Pf") == 0)
+    channels = 1;
+  else
+    return false;
+
+  std::vector<float> row((size_t)w * channels);
+  frame.width = w;
+  frame.height = h;
+  frame.pixels.resize((size_t)w * h * 4);
+  for (int y = 0; y < h; ++y) {
+    if (std::fread(row.data(), sizeof(float), row.size(), f) != row.size())
+      return false;
+    if (scale > 0.0) { // big-endian payload
+      for (float &v : row) {
+        uint32_t u;
+        std::memcpy(&u, &v, 4);
+        u = (u >> 24) | ((u >> 8) & 0xFF00u) | ((u << 8) & 0xFF0000u) |
+            (u << 24);
+        std::memcpy(&v, &u, 4);
+      }
+    }
+    float *out = &frame.pixels[(size_t)y * w * 4];
+    for (int x = 0; x < w; ++x) {
+      const float *s = &row[(size_t)x * channels];
+      out[x * 4 + 0] = s[0];
+      out[x * 4 + 1] = s[channels == 3 ? 1 : 0];
+      out[x * 4 + 2] = s[channels == 3 ? 2 : 0];
+      out[x * 4 + 3] = 1.0f;
+    }
+  }
+  return true;
+}
+
+static bool writePFM(FILE *f, const Frame &frame) {
+  const int w = frame.width;
+  std::fprintf(f, "PF\n%d %d\n-1.0\n", w, frame.height);
+  std::vector<float> row((size_t)w * 3);
+  for (int y = 0; y < frame.height; ++y) {
+    const float *in = &frame.pixels[(size_t)y * w * 4];
+    for (int x = 0; x < w; ++x) {
+      row[x * 3 + 0] = in[x * 4 + 0];
+      row[x * 3 + 1] = in[x * 4 + 1];
+      row[x * 3 + 2] = in[x * 4 + 2];
+    }
+    if (std::fwrite(row.data(), sizeof(float), row.size(), f) != row.size())
+      return false;
+  }
+  return true;
+}
+
+// Raw files are interleaved, top row first, no header
+static bool readRaw(FILE *f, FileFormat format, const RawLayout &layout,
+                    Frame &frame) {
+  const int w = layout.width, h = layout.height, ch = layout.channels;
+  const size_t count = (size_t)w * ch;
+  std::vector<float> row(count);
+  std::vector<uint16_t> halfRow(format == eFormatRawHalf ? count : 0);
+  frame.width = w;
+  frame.height = h;
+  frame.pixels.resize((size_t)w * h * 4);
+  for (int y = h - 1; y >= 0; --y) {
+    if (format == eFormatRawHalf) {
+      if (std::fread(halfRow.data(), 2, count, f) != count)
+        return false;
+      Half::toFloat(halfRow.data(), row.data(), count);
+    } else if (std::fread(row.data(), 4, count, f) != count) {
+      return false;
+    }
+    float *out = &frame.pixels[(size_t)y * w * 4];
+    for (int x = 0; x < w; ++x) {
+      out[x * 4 + 0] = row[(size_t)x * ch + 0];
+      out[x * 4 + 1] = row[(size_t)x * ch + 1];
+      out[x * 4 + 2] = row[(size_t)x * ch + 2];
+      out[x * 4 + 3] = ch == 4 ? row[(size_t)x * ch + 3] : 1.0f;
+    }
+  }
+  return true;
+}
+
+static bool writeRaw(FILE *f, FileFormat format, int channels,
+                     const Frame &frame) {
+  const int w = frame.width;
+  const size_t count = (size_t)w * channels;
+  std::vector<float> row(count);
+  std::vector<uint16_t> halfRow(format == eFormatRawHalf ? count : 0);
+  for (int y = frame.height - 1; y >= 0; --y) {
+    const float *in = &frame.pixels[(size_t)y * w * 4];
+    for (int x = 0; x < w; ++x)
+      for (int c = 0; c < channels; ++c)
+        row[(size_t)x * channels + c] = in[x * 4 + c];
+    if (format == eFormatRawHalf) {
+      Half::fromFloat(row.data(), halfRow.data(), count);
+      if (std::fwrite(halfRow.data(), 2, count, f) != count)
+        return false;
+    } else if (std::fwrite(row.data(), 4, count, f) != count) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool readFrame(const std::string &path, const RawLayout &layout,
+                      Frame &frame) {
+  FILE *f = std::fopen(path.c_str(), "rb");
+  if (!f)
+    return false;
+  const FileFormat format = formatFor(path);
+  const bool ok = format == eFormatPFM ? readPFM(f, frame)
+                                       : readRaw(f, format, layout, frame);
+  std::fclose(f);
+  return ok;
+}
+
+static bool writeFrame(const std::string &path, int channels,
+                       const Frame &frame) {
+  FILE *f = std::fopen(path.c_str(), "wb");
+  if (!f)
+    return false;
+  const FileFormat format = formatFor(path);
+  bool ok = format == eFormatPFM ? writePFM(f, frame)
+                                 : writeRaw(f, format, channels, frame);
+  ok = (std::fclose(f) == 0) && ok;
+  return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Bounded hand-off queue between the I/O threads and the frame workers
+////////////////////////////////////////////////////////////////////////////////
+
+template <class T> class BoundedQueue {
+public:
+  explicit BoundedQueue(size_t capacity)
+      : _capacity(std::max<size_t>(1, capacity)), _closed(false) {}
+
+  void push(T item) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _notFull.wait(lock, [this] { return _items.size() < _capacity; });
+    _items.push_back(std::move(item));
+    _notEmpty.notify_one();
+  }
+
+  // False once the queue is closed and drained
+  bool pop(T &item) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _notEmpty.wait(lock, [this] { return _closed || !_items.empty(); });
+    if (_items.empty())
+      return false;
+    item = std::move(_items.front());
+    _items.pop_front();
+    _notFull.notify_one();
+    return true;
+  }
+
+  void close() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _closed = true;
+    _notEmpty.notify_all();
+  }
+
+private:
+  std::deque<T> _items;
+  size_t _capacity;
+  bool _closed;
+  std::mutex _mutex;
+  std::condition_variable _notEmpty;
+  std::condition_variable _notFull;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Driver
+////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+  std::string params;
+  std::string input;
+  std::string output;
+  int first = 0;
+  int last = 0;
+  unsigned threads = 0;
+  int framesInFlight = 2;
+  int readAhead = 4;
+  int writeBehind = 4;
+  int quality = -1; // -1 = from the parameter file
+  RawLayout raw;
+};
+
+static void usage() {
+  std::fprintf(
+      stderr,
+      "usage: cie_render -i <input pattern> -o <output pattern> -f <first>-"
+      "<last>\n"
+      "                  [-p params.json] [-q draft|normal|final]\n"
+      "                  [-t threads] [-j frames in flight]\n"
+      "                  [--size WxH] [--channels 3|4]\n"
+      "                  [--read-ahead N] [--write-behind N]\n"
+      "\n"
+      "Patterns are printf-style, e.g. shot.%%04d.pfm. The format follows\n"
+      "the extension: .pfm, .f16/.half (raw half) or anything else (raw\n"
+      "float). Raw files are interleaved, top row first, and need --size.\n"
+      "Parameter names match the plugin's; missing ones use its defaults.\n");
+}
+
+static bool parseArgs(int argc, char **argv, Options &o) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    auto next = [&]() -> const char * {
+      return i + 1 < argc ? argv[++i] : nullptr;
+    };
+    const char *v = nullptr;
+    if (a == "-h" || a == "--help") {
+      return false;
+    } else if (a == "-p" && (v = next())) {
+      o.params = v;
+    } else if (a == "-i" && (v = next())) {
+      o.input = v;
+    } else if (a == "-o" && (v = next())) {
+      o.output = v;
+    } else if (a == "-f" && (v = next())) {
+      if (std::sscanf(v, "%d-%d", &o.first, &o.last) == 1)
+        o.last = o.first;
+    } else if (a == "-t" && (v = next())) {
+      o.threads = (unsigned)std::max(0, std::atoi(v));
+    } else if (a == "-j" && (v = next())) {
+      o.framesInFlight = std::max(1, std::atoi(v));
+    } else if (a == "-q" && (v = next())) {
+      const std::string q = v;
+      o.quality = q == "draft" ? eQualityDraft
+                  : q == "final" ? eQualityFinal
+                                 : eQualityNormal;
+    } else if (a == "--size" && (v = next())) {
+      std::sscanf(v, "%dx%d", &o.raw.width, &o.raw.height);
+    } else if (a == "--channels" && (v = next())) {
+      o.raw.channels = std::atoi(v) == 3 ? 3 : 4;
+    } else if (a == "--read-ahead" && (v = next())) {
+      o.readAhead = std::max(1, std::atoi(v));
+    } else if (a == "--write-behind" && (v = next())) {
+      o.writeBehind = std::max(1, std::atoi(v));
+    } else {
+      std::fprintf(stderr, "cie_render: bad argument '%s'\n", a.c_str());
+      return false;
+    }
+  }
+  if (o.input.empty() || o.output.empty() || o.last < o.first)
+    return false;
+  if (formatFor(o.input) != eFormatPFM &&
+      (o.raw.width <= 0 || o.raw.height <= 0)) {
+    std::fprintf(stderr, "cie_render: raw input needs --size WxH\n");
+    return false;
+  }
+  return true;
+}
+
+// Splits the frame into horizontal strips across the pool, the same way the
+// OFX host slices a render window between its threads.
+static void renderFrame(ThreadPool &pool, const Pipeline &pipeline,
+                        Frame &src, Frame &dst) {
+  dst.number = src.number;
+  dst.width = src.width;
+  dst.height = src.height;
+  dst.pixels.resize(src.pixels.size());
+
+  const Pipeline::Rect bounds = {0, 0, src.width, src.height};
+  const ptrdiff_t rowBytes = (ptrdiff_t)src.width * 4 * sizeof(float);
+  const Pipeline::ImageView srcView = {src.pixels.data(), bounds, rowBytes};
+  const Pipeline::ImageView dstView = {dst.pixels.data(), bounds, rowBytes};
+
+  // Output does not depend on the strip layout (apron buffers sit on a
+  // global grid), so strips are only cut where they pay: no more than there
+  // are workers, and at least twice the apron tall, since every strip also
+  // renders the apron above and below it.
+  static constexpr int kStripRows = 128;
+  const int stripRows = std::max(kStripRows, 2 * pipeline.apron());
+  const int strips = std::max(
+      1, std::min(src.height / stripRows, (int)std::max(1u, pool.size())));
+  pool.parallelFor(strips, [&](int s) {
+    const int y1 = (int)((int64_t)src.height * s / strips);
+    const int y2 = (int)((int64_t)src.height * (s + 1) / strips);
+    pipeline.processWindow(srcView, dstView, {0, y1, src.width, y2});
+  });
+}
+
+int main(int argc, char **argv) {
+  Options opt;
+  if (!parseArgs(argc, argv, opt)) {
+    usage();
+    return 2;
+  }
+
+  ParamValues values;
+  if (!loadParams(opt.params, values))
+    return 2;
+  if (opt.quality >= 0)
+    values["QualityMode"] = opt.quality;
+
+  Pipeline look;
+  applyParams(look, values);
+
+  ThreadPool pool(opt.threads);
+  GrainField grainCache;
+  look.setGrainCache(&grainCache);
+  // Blurs inside a strip fan out on the same pool; idle workers pick up
+  // chunks, busy ones leave them to the calling thread.
+  Utils::Scheduler scheduler;
+  scheduler.run = [&pool](int n, const std::function<void(int)> &fn) {
+    pool.parallelFor(n, fn);
+  };
+  look.setScheduler(&scheduler);
+  BoundedQueue<Frame> decoded((size_t)opt.readAhead);
+  BoundedQueue<Frame> rendered((size_t)opt.writeBehind);
+  std::atomic<int> failures(0);
+  std::mutex logMutex;
+  const auto start = std::chrono::steady_clock::now();
+
+  // Read-ahead
+  std::thread reader([&] {
+    for (int n = opt.first; n <= opt.last; ++n) {
+      Frame frame;
+      frame.number = n;
+      const std::string path = framePath(opt.input, n);
+      if (!readFrame(path, opt.raw, frame)) {
+        std::lock_guard<std::mutex> lock(logMutex);
+        std::fprintf(stderr, "cie_render: cannot read %s\n", path.c_str());
+        ++failures;
+        continue;
+      }
+      decoded.push(std::move(frame));
+    }
+    decoded.close();
+  });
+
+  // Write-behind
+  const int outChannels =
+      formatFor(opt.input) == eFormatPFM ? 4 : opt.raw.channels;
+  std::thread writer([&] {
+    Frame frame;
+    while (rendered.pop(frame)) {
+      const std::string path = framePath(opt.output, frame.number);
+      const bool ok = writeFrame(path, outChannels, frame);
+      std::lock_guard<std::mutex> lock(logMutex);
+      if (ok) {
+        std::fprintf(stderr, "frame %d -> %s\n", frame.number, path.c_str());
+      } else {
+        std::fprintf(stderr, "cie_render: cannot write %s\n", path.c_str());
+        ++failures;
+      }
+    }
+  });
+
+  // Frames in flight; each fans its strips out onto the shared pool
+  std::vector<std::thread> workers;
+  for (int j = 0; j < opt.framesInFlight; ++j) {
+    workers.emplace_back([&] {
+      Pipeline pipeline = look;
+      Frame src;
+      while (decoded.pop(src)) {
+        pipeline.setTime((double)src.number);
+        pipeline.setSourceRoD({0.0, 0.0, (double)src.width,
+                               (double)src.height});
+        pipeline.prepareFrame();
+        Frame dst;
+        renderFrame(pool, pipeline, src, dst);
+        rendered.push(std::move(dst));
+      }
+    });
+  }
+
+  for (std::thread &t : workers)
+    t.join();
+  rendered.close();
+  reader.join();
+  writer.join();
+
+  const double secs = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+  const int total = opt.last - opt.first + 1;
+  std::fprintf(stderr, "%d/%d frames in %.2f s (%.2f fps), %u threads\n",
+               total - failures.load(), total, secs,
+               secs > 0.0 ? (total - failures.load()) / secs : 0.0,
+               pool.size());
+  return failures.load() ? 1 : 0;
+}
@@ -1,19 +1,28 @@
 #pragma once
 
+#include "BlurPyramid.h"
 #include "Utils.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
+#include <vector>
 
 namespace CinematicGlow {
 
+enum Mode { eSingle = 0, eBloom = 1 };
+
 struct Params {
     bool enable;
     double amount;
     double threshold;
     double knee;
-    double radius;
+    double radius;        // Single: the blur; Bloom: the widest octave
     double colorFidelity;
     double warmth;
+    int mode;             // Mode: one Gaussian, or a sum of octaves
+    int octaves;          // Bloom: 4..8, each half the radius of the next
+    double falloff;       // Bloom: weight of each octave over the narrower one
+    double tailTint;      // Bloom: warmth reached by the widest octave
 };
 
 // Removed skinMask param to match call site or updated call site?
@@ -78,4 +87,147 @@ inline void applyGlow(float& r, float& g, float& b, float glowR, float glowG, fl
     b += glowB * a;
 }
 
+// ============================================================================
+// Bloom — several octaves from one pyramid
+//
+// Lens bloom is a sum of blurs with a heavy tail. Octave j of n has radius
+// radius / 2^(n-1-j) and weight falloff^j (normalised to 1, so Amount
+// means what it does for Single), and its warmth ramps from none at the
+// narrowest octave to tailTint at the widest. Every octave blurs the
+// source's BlurPyramid level for its radius, and the levels are summed top
+// down: each level's sum is upsampled 2x into the next finer level and
+// that level's octaves are added in, so the whole tail costs one chain of
+// upsamples. Octaves too narrow for level 1 (Final) merge into one core
+// octave at their weighted RMS radius.
+// ============================================================================
+
+// Per-channel gain of a warmth bias (same response as Glow Warmth)
+inline void warmthGain(float w, float gain[3]) {
+    gain[0] = gain[1] = gain[2] = 1.0f;
+    if (w > 0) {
+        gain[0] = 1.0f + w * 0.5f;
+        gain[2] = 1.0f - w * 0.2f;
+    } else if (w < 0) {
+        gain[2] = 1.0f + std::abs(w) * 0.5f;
+        gain[0] = 1.0f - std::abs(w) * 0.2f;
+    }
+}
+
+// acc = a * acc + b * x, per plane; sizes must match
+template <class T>
+inline void mulAdd(PlanarImageT<T>& acc, const float a[3],
+                   const PlanarImageT<T>& x, const float b[3],
+                   const Utils::Scheduler* sched) {
+    const int w = acc.width();
+    Utils::parallelFor(sched, 3, [&](int c) {
+        std::vector<float> scratch(Utils::scratchSize<T>((size_t)2 * w));
+        for (int y = 0; y < acc.height(); ++y) {
+            T* row = acc.row(c, y);
+            float* o = Utils::rowTarget(row, scratch.data());
+            const float* ai = Utils::widenRow(row, scratch.data(), w);
+            const float* xi = Utils::widenRow(
+                x.row(c, y), scratch.data() + scratch.size() / 2, w);
+            for (int i = 0; i < w; ++i)
+                o[i] = a[c] * ai[i] + b[c] * xi[i];
+            Utils::saturateRow(row, o, w);
+            Utils::narrowRow(row, o, w);
+        }
+    });
+}
+
+// Replace the glow source in layer (3 planes) by its bloom; radius in
+// pixels; tmp is scratch of layer's size
+template <class T>
+inline void bloom(PlanarImageT<T>& layer, PlanarImageT<T>& tmp,
+                  double radius, bool draft, const Params& params,
+                  const Utils::Scheduler* sched = nullptr) {
+    const int n = std::max(4, std::min(8, params.octaves));
+    const float falloff = std::max(0.0f, (float)params.falloff);
+
+    // Octaves: radius, level, weight and per-channel gain. Octaves below
+    // level 1 are merged into one core octave at their weighted RMS radius.
+    struct Octave {
+        int radius;
+        int level;
+        bool box; // One box pass (Draft, or the core)
+        float gain[3];
+    };
+    std::vector<float> weight(n);
+    float wSum = 0.0f;
+    for (int j = 0; j < n; ++j) {
+        weight[j] = std::pow(falloff, (float)j);
+        wSum += weight[j];
+    }
+    std::vector<Octave> octaves;
+    Octave core = {0, 0, draft, {0.0f, 0.0f, 0.0f}};
+    float coreVar = 0.0f, coreW = 0.0f;
+    int top = 0;
+    for (int j = 0; j < n; ++j) {
+        Octave o;
+        o.radius = std::max(1, (int)std::lround(std::ldexp(radius, j - (n - 1))));
+        o.level = BlurPyramidT<T>::levelFor(o.radius, draft);
+        o.box = draft;
+        float wg[3];
+        warmthGain((float)params.tailTint * (float)j / (float)(n - 1), wg);
+        for (int c = 0; c < 3; ++c)
+            o.gain[c] = wSum > 0.0f ? wg[c] * weight[j] / wSum : 0.0f;
+        top = std::max(top, o.level);
+        if (o.level > 0) {
+            octaves.push_back(o);
+            continue;
+        }
+        for (int c = 0; c < 3; ++c)
+            core.gain[c] += o.gain[c];
+        coreVar += weight[j] * (float)o.radius * (float)o.radius;
+        coreW += weight[j];
+    }
+    const float zero[3] = {0.0f, 0.0f, 0.0f};
+    const float one[3] = {1.0f, 1.0f, 1.0f};
+    if (coreW > 0.0f)
+        core.radius = std::max(1, (int)std::lround(std::sqrt(coreVar / coreW)));
+
+    // Every octave at full resolution (a small radius): one blur
+    BlurPyramidT<T> pyramid(layer, 3, sched);
+    if (top == 0) {
+        pyramid.blur(core.radius, draft, layer, tmp);
+        mulAdd(layer, core.gain, layer, zero, sched);
+        return;
+    }
+
+    // Otherwise the core runs at level 1 too, as one box pass of its
+    // variance: a full-resolution Gaussian would cost more than the rest of
+    // the bloom, for a few pixels of shape the up-chain smooths anyway
+    if (coreW > 0.0f) {
+        core.level = 1;
+        core.box = true;
+        octaves.push_back(core);
+    }
+
+    // Build every level before layer is overwritten, then sum top down
+    pyramid.level(top);
+    PlanarImageT<T> acc, up, blurred;
+    for (int l = top; l >= 1; --l) {
+        bool filled = l < top;
+        if (filled) {
+            const PlanarImageT<T>& lv = pyramid.level(l);
+            up.allocate(lv.width(), lv.height(), 3);
+            Utils::upsample2xBilinear(acc, up, sched);
+            std::swap(acc, up);
+        }
+        for (const Octave& o : octaves) {
+            if (o.level != l)
+                continue;
+            pyramid.blurAt(o.radius, l, o.box, blurred);
+            if (filled) {
+                mulAdd(acc, one, blurred, o.gain, sched);
+            } else {
+                std::swap(acc, blurred);
+                mulAdd(acc, o.gain, acc, zero, sched);
+                filled = true;
+            }
+        }
+    }
+    Utils::upsample2xBilinear(acc, layer, sched);
 }
+
+} // namespace CinematicGlow
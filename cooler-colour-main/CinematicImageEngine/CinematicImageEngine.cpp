@@ -4,9 +4,14 @@
 #include <cctype>
 #include <cmath>
 #include <cstring>
+#include <memory>
+#include <string>
 #include <vector>
 
-#include "Utils.h"
+#include "DiskCache.h"
+#include "FrameCache.h"
+#include "Pipeline.h"
+#include "ThreadPool.h"
 #include "ofxsImageEffect.h"
 #include "ofxsInteract.h"
 #include "ofxsLog.h"
@@ -39,359 +44,128 @@
 // Pipeline Processor
 ////////////////////////////////////////////////////////////////////////////////
 
-class PipelineProcessor : public OFX::ImageProcessor {
+// OFX adapter: the host splits the render window across its threads and
+// each slice is rendered by the host-independent Pipeline.
+class PipelineProcessor : public OFX::ImageProcessor, public Pipeline {
 public:
   explicit PipelineProcessor(OFX::ImageEffect &p_Instance)
-      : OFX::ImageProcessor(p_Instance), _srcImg(nullptr), _renderScaleX(1.0),
-        _time(0.0), _rod{0, 0, 0, 0} {}
+      : OFX::ImageProcessor(p_Instance), _srcImg(nullptr) {}
 
+  virtual void process();
   virtual void multiThreadProcessImages(OfxRectI p_ProcWindow);
 
   void setSrcImg(OFX::Image *p_SrcImg) { _srcImg = p_SrcImg; }
-  void setRenderScale(double scaleX) { _renderScaleX = scaleX; }
-  void setTime(double t) { _time = t; }
-  void setSourceRoD(const OfxRectD &rod) { _rod = rod; }
-
-  // Params
-  ColorIngestTweaks::Params cit;
-  FilmResponse::Params pcr;
-  TonalEngine::Params tonal;
-  ColorEnergyEngine::Params energy;
-  HighlightProtection::Params hlp;
-  SplitToning::Params split;
-  FilmGrain::Params grain;
-
-  Dither::Params dither;
-
-  // Spatial
-  DreamyMist::Params mist;
-  DreamyBlur::Params blur;
-  CinematicGlow::Params glow;
-  AnamorphicStreak::Params streak;
-  Sharpening::Params sharp;
-  Halation::Params halo;
-  ChromaticAberration::Params ca;
-  Vignette::Params vig;
 
 private:
   OFX::Image *_srcImg;
-  double _renderScaleX;
-  double _time;
-  OfxRectD _rod;
 };
 
-void PipelineProcessor::multiThreadProcessImages(OfxRectI p_ProcWindow) {
-  if (!_dstImg || !_srcImg)
-    return;
-
-  // ========================================================================
-  // APRON CALCULATION
-  // ========================================================================
-  const float mistR = mist.enable ? 6.0f * (float)_renderScaleX : 0.0f;
-  float blurR = blur.enable ? (float)(blur.blurRadius * _renderScaleX) : 0.0f;
-  const float glowR = glow.enable ? (float)(glow.radius * _renderScaleX) : 0.0f;
-  float haloR = halo.enable ? (float)(halo.radius * _renderScaleX) : 0.0f;
-  const float sharpR = sharp.enable ? 2.0f : 0.0f;
-  float defR = 0.0f;
-  if (vig.enable && vig.type == Vignette::eDefocus) {
-    defR = (float)(vig.defocusSoftness * 20.0 * _renderScaleX);
-  }
-
-  if (haloR > 50.0f)
-    haloR = 50.0f;
-  if (blurR < 0.0f)
-    blurR = 0.0f;
-
-  float totalR = 0.0f;
-  if (mist.enable)
-    totalR = std::max(totalR, mistR);
-  if (blur.enable)
-    totalR += blurR;
-  if (halo.enable)
-    totalR += haloR;
-  if (glow.enable)
-    totalR += glowR;
-  if (sharp.enable)
-    totalR += sharpR;
-  if (defR > 0)
-    totalR += defR;
-
-  const int apron = (int)std::ceil(totalR) + 2;
-
-  OfxRectI bufARect = p_ProcWindow;
-  bufARect.x1 -= apron;
-  bufARect.x2 += apron;
-  bufARect.y1 -= apron;
-  bufARect.y2 += apron;
-
-  const int bufAW = bufARect.x2 - bufARect.x1;
-  const int bufAH = bufARect.y2 - bufARect.y1;
-  const int bufPixels = bufAW * bufAH;
-  const int bufSize = bufPixels * 4;
-
-  // ========================================================================
-  // BUFFER ALLOCATION  –  single shared temp buffer for ALL blur operations
-  // ========================================================================
-  std::vector<float> bufA(bufSize);
-  std::vector<float> bufB(bufSize);
-
-  // Only allocate the blur scratch buffer if any spatial effect is enabled
-  const bool anySpatial = mist.enable || blur.enable || glow.enable ||
-                          streak.enable || sharp.enable || halo.enable ||
-                          ca.enable;
-  std::vector<float> bufTemp;
-  if (anySpatial) {
-    bufTemp.resize(bufSize);
-  }
-
-  const OfxRectI srcBounds = _srcImg->getBounds();
-  auto getSrcPixel = [&](int x, int y, float *outR, float *outG, float *outB) {
-    float *p = (float *)_srcImg->getPixelAddress(x, y);
-    if (!p) {
-      int cx = std::min(std::max(x, srcBounds.x1), srcBounds.x2 - 1);
-      int cy = std::min(std::max(y, srcBounds.y1), srcBounds.y2 - 1);
-      p = (float *)_srcImg->getPixelAddress(cx, cy);
-    }
-    if (p) {
-      *outR = p[0];
-      *outG = p[1];
-      *outB = p[2];
-    } else {
-      *outR = 0;
-      *outG = 0;
-      *outB = 0;
-    }
-  };
+static Pipeline::ImageView imageView(OFX::Image &img) {
+  const OfxRectI b = img.getBounds();
+  Pipeline::ImageView v;
+  v.data = (float *)img.getPixelAddress(b.x1, b.y1);
+  v.bounds = {b.x1, b.y1, b.x2, b.y2};
+  v.rowBytes = img.getRowBytes();
+  return v;
+}
 
-  // ========================================================================
-  // PRE-COMPUTE per-frame constants (moved out of pixel loop)
-  // ========================================================================
-  const int frameSeed = grain.enable ? (int)std::floor(_time * 24.0) : 0;
-  const int imgW = (int)(_rod.x2 - _rod.x1);
-  const int imgH = (int)(_rod.y2 - _rod.y1);
-
-  // ========================================================================
-  // STAGE 0: Per-Pixel Pipeline
-  // Order: CIT -> PCR -> Tonal -> Energy -> HLP -> Split -> Grain
-  // ========================================================================
-  for (int y = 0; y < bufAH; ++y) {
-    const int gy = bufARect.y1 + y;
-    float *rowOut = &bufA[y * bufAW * 4];
-
-    for (int x = 0; x < bufAW; ++x) {
-      const int gx = bufARect.x1 + x;
-      float r, g, b;
-      getSrcPixel(gx, gy, &r, &g, &b);
-
-      // 1. Color Ingest Tweaks
-      if (cit.enable)
-        ColorIngestTweaks::process(&r, &g, &b, cit);
-
-      // 2. Photochemical Color Response
-      if (pcr.enable)
-        FilmResponse::processPixel(&r, &g, &b, pcr);
-
-      // 3. Tonal Engine
-      TonalEngine::processPixel(&r, &g, &b, tonal);
-
-      // 4. Color Energy Engine
-      if (energy.enable)
-        ColorEnergyEngine::process(&r, &g, &b, energy);
-
-      // 5. Highlight Protection
-      HighlightProtection::processPixel(&r, &g, &b, hlp);
-
-      // 6. Split Toning
-      if (split.enable)
-        SplitToning::processPixel(&r, &g, &b, split);
-
-      // 7. Film Grain
-      if (grain.enable)
-        FilmGrain::applyGrain(&r, &g, &b, gx, gy, frameSeed, imgW, imgH, grain);
-
-      // 8. Dither (banding reduction)
-      if (dither.enable)
-        Dither::process(&r, &g, &b, gx, gy, dither);
-
-      // Store
-      float *out = rowOut + x * 4;
-      out[0] = r;
-      out[1] = g;
-      out[2] = b;
-      out[3] = 1.0f;
-    }
+// Every slice re-renders the apron around it, so the default one-slice-per-
+// CPU split can cost more than it saves. Same rule as cie_render: no more
+// slices than CPUs, each at least twice the apron (and 128 rows) tall.
+void PipelineProcessor::process() {
+  const int w = _renderWindow.x2 - _renderWindow.x1;
+  const int h = _renderWindow.y2 - _renderWindow.y1;
+  if (w <= 0 || h <= 0)
+    return;
+  if (_dstImg) {
+    const OfxRectI b = _dstImg->getBounds();
+    if (_renderWindow.x1 < b.x1 || _renderWindow.x2 > b.x2 ||
+        _renderWindow.y1 < b.y1 || _renderWindow.y2 > b.y2)
+      return;
   }
+  static constexpr int kStripRows = 128;
+  const int stripRows = std::max(kStripRows, 2 * apron());
+  const unsigned slices = (unsigned)std::max(1, h / stripRows);
+  preProcess();
+  multiThread(std::max(1u, std::min(slices, OFX::MultiThread::getNumCPUs())));
+  postProcess();
+}
 
-  // ========================================================================
-  // STAGE 1: Spatial Effects  –  reusing bufTemp across all effects
-  // ========================================================================
-
-  // Mist
-  if (mist.enable) {
-    const int r = std::max(1, (int)std::ceil(mistR));
-    for (int i = 0; i < bufPixels; ++i) {
-      const float *s = &bufA[i * 4];
-      float mR, mG, mB;
-      DreamyMist::computeMistSource(s[0], s[1], s[2], mR, mG, mB, mist);
-      bufB[i * 4 + 0] = mR;
-      bufB[i * 4 + 1] = mG;
-      bufB[i * 4 + 2] = mB;
-      bufB[i * 4 + 3] = 0.0f;
-    }
-    Utils::gaussianBlur(bufB.data(), bufB.data(), bufTemp.data(), bufAW, bufAH,
-                        r);
-    for (int i = 0; i < bufPixels; ++i) {
-      float *d = &bufA[i * 4];
-      const float *m = &bufB[i * 4];
-      DreamyMist::applyMist(d[0], d[1], d[2], m[0], m[1], m[2], mist);
-    }
-  }
+void PipelineProcessor::multiThreadProcessImages(OfxRectI p_ProcWindow) {
+  if (!_dstImg || !_srcImg)
+    return;
+  processWindow(imageView(*_srcImg), imageView(*_dstImg),
+                {p_ProcWindow.x1, p_ProcWindow.y1, p_ProcWindow.x2,
+                 p_ProcWindow.y2});
+}
 
-  // Dreamy Blur
-  if (blur.enable) {
-    const int r = std::max(1, (int)std::ceil(blurR));
-    std::memcpy(bufB.data(), bufA.data(), bufSize * sizeof(float));
-    Utils::gaussianBlur(bufB.data(), bufB.data(), bufTemp.data(), bufAW, bufAH,
-                        r);
-    for (int i = 0; i < bufPixels; ++i) {
-      float *d = &bufA[i * 4];
-      const float *bl = &bufB[i * 4];
-      DreamyBlur::applyDreamyBlur(d[0], d[1], d[2], bl[0], bl[1], bl[2], blur);
-    }
-  }
+// Workers the blurs inside a host slice fan out onto. One pool serves every
+// instance, so opening more of them adds no threads. parallelFor has the
+// host thread work through its own chunks too, so a slice never waits on
+// workers that are busy with another one.
+static const Utils::Scheduler &blurScheduler() {
+  static ThreadPool pool;
+  static const Utils::Scheduler scheduler = {
+      [](int n, const std::function<void(int)> &fn) {
+        pool.parallelFor(n, fn);
+      }};
+  return scheduler;
+}
 
-  // Cinematic Glow
-  if (glow.enable) {
-    const int r = std::max(1, (int)std::ceil(glowR));
-    for (int i = 0; i < bufPixels; ++i) {
-      const float *s = &bufA[i * 4];
-      float gR, gG, gB;
-      CinematicGlow::computeGlowSource(s[0], s[1], s[2], gR, gG, gB, glow);
-      bufB[i * 4 + 0] = gR;
-      bufB[i * 4 + 1] = gG;
-      bufB[i * 4 + 2] = gB;
-      bufB[i * 4 + 3] = 0.0f;
-    }
-    Utils::gaussianBlur(bufB.data(), bufB.data(), bufTemp.data(), bufAW, bufAH,
-                        r);
-    for (int i = 0; i < bufPixels; ++i) {
-      float *d = &bufA[i * 4];
-      const float *gl = &bufB[i * 4];
-      CinematicGlow::applyGlow(d[0], d[1], d[2], gl[0], gl[1], gl[2], glow);
-    }
-  }
 
-  // Anamorphic Streak
-  if (streak.enable) {
-    const int sLen = std::max(1, (int)(streak.length * 80.0 * _renderScaleX));
-    for (int i = 0; i < bufPixels; ++i) {
-      const float *s = &bufA[i * 4];
-      float sR, sG, sB;
-      AnamorphicStreak::computeStreakSource(s[0], s[1], s[2], sR, sG, sB,
-                                            streak);
-      bufB[i * 4 + 0] = sR;
-      bufB[i * 4 + 1] = sG;
-      bufB[i * 4 + 2] = sB;
-      bufB[i * 4 + 3] = 0.0f;
-    }
-    // Horizontal-only blur (3 passes for Gaussian approximation)
-    // Ping-pong between bufB and bufTemp to avoid in-place aliasing
-    AnamorphicStreak::boxBlurH1D(bufB.data(), bufTemp.data(), bufAW, bufAH,
-                                 sLen);
-    AnamorphicStreak::boxBlurH1D(bufTemp.data(), bufB.data(), bufAW, bufAH,
-                                 sLen);
-    AnamorphicStreak::boxBlurH1D(bufB.data(), bufTemp.data(), bufAW, bufAH,
-                                 sLen);
-    // Result is in bufTemp — copy back to bufB for the apply step
-    std::memcpy(bufB.data(), bufTemp.data(), bufSize * sizeof(float));
-    for (int i = 0; i < bufPixels; ++i) {
-      float *d = &bufA[i * 4];
-      AnamorphicStreak::applyStreak(d[0], d[1], d[2], bufB[i * 4],
-                                    bufB[i * 4 + 1], bufB[i * 4 + 2], streak);
-    }
-  }
-
-  // Sharpening
-  if (sharp.enable) {
-    const int r = std::max(1, (int)std::ceil(sharpR));
-    std::memcpy(bufB.data(), bufA.data(), bufSize * sizeof(float));
-    Utils::gaussianBlur(bufB.data(), bufB.data(), bufTemp.data(), bufAW, bufAH,
-                        r);
-    for (int i = 0; i < bufPixels; ++i) {
-      float *d = &bufA[i * 4];
-      const float *bl = &bufB[i * 4];
-      Sharpening::applySharpen(d[0], d[1], d[2], bl[0], bl[1], bl[2], sharp);
-    }
-  }
+////////////////////////////////////////////////////////////////////////////////
+// Frame cache helpers
+////////////////////////////////////////////////////////////////////////////////
 
-  // Halation
-  if (halo.enable) {
-    const int r = std::max(1, (int)std::ceil(haloR));
-    for (int i = 0; i < bufPixels; ++i) {
-      const float *s = &bufA[i * 4];
-      float hR, hG, hB;
-      Halation::computeHalationSource(s[0], s[1], s[2], hR, hG, hB, halo);
-      bufB[i * 4 + 0] = hR;
-      bufB[i * 4 + 1] = hG;
-      bufB[i * 4 + 2] = hB;
-      bufB[i * 4 + 3] = 0.0f;
-    }
-    Utils::gaussianBlur(bufB.data(), bufB.data(), bufTemp.data(), bufAW, bufAH,
-                        r);
-    for (int i = 0; i < bufPixels; ++i) {
-      float *d = &bufA[i * 4];
-      const float *h = &bufB[i * 4];
-      Halation::applyHalation(d, d + 1, d + 2, h[0], h[1], h[2], halo);
-    }
-  }
+// One cache for the whole process, so the Frame Cache budget bounds the
+// plugin's memory however many instances a project opens. Each render sets
+// the budget from its instance's param; keys carry every param and source
+// pixel, so instances never serve each other a wrong frame.
+static FrameCache &frameCache() {
+  static FrameCache cache;
+  return cache;
+}
 
-  // Chromatic Aberration
-  if (ca.enable) {
-    std::memcpy(bufB.data(), bufA.data(), bufSize * sizeof(float));
-    ChromaticAberration::process(bufB.data(), bufA.data(), bufAW, bufAH,
-                                 (float)_rod.x1, (float)_rod.y1, (float)imgW,
-                                 (float)imgH, bufARect.x1, bufARect.y1, ca);
+// Source fingerprint: bounds plus every pixel the host handed us, row by
+// row. A sampled grid missed local upstream changes (a paint fix, a moved
+// roto shape) and served stale frames; a full pass of hashWords costs a
+// few ms at 1080p, against a render of hundreds.
+static uint64_t sourceFingerprint(const OFX::Image &img) {
+  const OfxRectI b = img.getBounds();
+  uint64_t h = FrameCache::hashValue(b, 0xcbf29ce484222325ull);
+  const int w = b.x2 - b.x1;
+  if (w <= 0)
+    return h;
+
+  const size_t rowBytes = (size_t)w * 4 * sizeof(float);
+  for (int y = b.y1; y < b.y2; ++y) {
+    const void *p = img.getPixelAddress(b.x1, y);
+    if (p)
+      h = FrameCache::hashWords(p, rowBytes, h);
   }
+  return h;
+}
 
-  // Vignette
-  if (vig.enable) {
-    const float vImgW = (float)imgW;
-    const float vImgH = (float)imgH;
-    const float aspect = vImgW / std::max(1.0f, vImgH);
-    const float invW = 1.0f / vImgW;
-    const float invH = 1.0f / vImgH;
-    const float rodX1 = (float)_rod.x1;
-    const float rodY1 = (float)_rod.y1;
-
-    for (int y = 0; y < bufAH; ++y) {
-      const float v = ((float)(bufARect.y1 + y) - rodY1) * invH;
-      for (int x = 0; x < bufAW; ++x) {
-        const float u = ((float)(bufARect.x1 + x) - rodX1) * invW;
-        const float V = Vignette::computeMask(u, v, aspect, vig);
-        float *d = &bufA[(y * bufAW + x) * 4];
-        Vignette::processPixel(d, d + 1, d + 2, V, vig);
-      }
-    }
+static void copyWindow(const float *src, OFX::Image &dst, const OfxRectI &win) {
+  const int w = win.x2 - win.x1;
+  const size_t rowBytes = (size_t)w * 4 * sizeof(float);
+  for (int y = win.y1; y < win.y2; ++y) {
+    float *d = (float *)dst.getPixelAddress(win.x1, y);
+    if (d)
+      std::memcpy(d, src + (size_t)(y - win.y1) * w * 4, rowBytes);
   }
+}
 
-  // ========================================================================
-  // FINAL OUTPUT  –  copy from apron buffer to destination
-  // ========================================================================
-  const int dstWidth = p_ProcWindow.x2 - p_ProcWindow.x1;
-  const int dstHeight = p_ProcWindow.y2 - p_ProcWindow.y1;
-  const int axOff = p_ProcWindow.x1 - bufARect.x1;
-  const int ayOff = p_ProcWindow.y1 - bufARect.y1;
-  const size_t rowBytes = (size_t)dstWidth * 4 * sizeof(float);
-
-  for (int y = 0; y < dstHeight; ++y) {
-    float *dstPix =
-        (float *)_dstImg->getPixelAddress(p_ProcWindow.x1, p_ProcWindow.y1 + y);
-    if (!dstPix)
-      continue;
-    const float *srcRow = &bufA[((ayOff + y) * bufAW + axOff) * 4];
-    // Use memcpy for bulk row transfer — the alpha channel is already 1.0
-    // from Stage 0, so we can copy all 4 channels directly.
-    std::memcpy(dstPix, srcRow, rowBytes);
+static void copyWindow(const OFX::Image &src, float *dst, const OfxRectI &win) {
+  const int w = win.x2 - win.x1;
+  const size_t rowBytes = (size_t)w * 4 * sizeof(float);
+  for (int y = win.y1; y < win.y2; ++y) {
+    const float *s = (const float *)src.getPixelAddress(win.x1, y);
+    float *d = dst + (size_t)(y - win.y1) * w * 4;
+    if (s)
+      std::memcpy(d, s, rowBytes);
+    else
+      std::memset(d, 0, rowBytes);
   }
 }
 
@@ -459,6 +233,7 @@ CinematicPlugin::CinematicPlugin(OfxImageEffectHandle p_Handle)
   // 7. Grain
   m_EnableGrain = fetchBooleanParam("EnableGrain");
   m_GrainType = fetchChoiceParam("GrainType");
+  m_GrainModel = fetchChoiceParam("GrainModel");
   m_GrainAmount = fetchDoubleParam("GrainAmount");
   m_GrainSize = fetchDoubleParam("GrainSize");
   m_GrainShadowWeight = fetchDoubleParam("GrainShadowWeight");
@@ -470,6 +245,8 @@ CinematicPlugin::CinematicPlugin(OfxImageEffectHandle p_Handle)
   // 8. Dither
   m_EnableDither = fetchBooleanParam("EnableDither");
   m_DitherAmount = fetchDoubleParam("DitherAmount");
+  m_DitherType = fetchChoiceParam("DitherType");
+  m_DitherAnimate = fetchBooleanParam("DitherAnimate");
 
   // 9. Spatial
   m_EnableMist = fetchBooleanParam("EnableMist");
@@ -494,6 +271,10 @@ CinematicPlugin::CinematicPlugin(OfxImageEffectHandle p_Handle)
   m_GlowRadius = fetchDoubleParam("GlowRadius");
   m_GlowFidelity = fetchDoubleParam("GlowFidelity");
   m_GlowWarmth = fetchDoubleParam("GlowWarmth");
+  m_GlowMode = fetchChoiceParam("GlowMode");
+  m_BloomOctaves = fetchIntParam("BloomOctaves");
+  m_BloomFalloff = fetchDoubleParam("BloomFalloff");
+  m_BloomTint = fetchDoubleParam("BloomTint");
 
   m_EnableSharp = fetchBooleanParam("EnableSharp");
   m_SharpType = fetchChoiceParam("SharpType");
@@ -512,6 +293,10 @@ CinematicPlugin::CinematicPlugin(OfxImageEffectHandle p_Handle)
   m_HaloWarmth = fetchDoubleParam("HaloWarmth");
   m_HaloRadius = fetchDoubleParam("HaloRadius");
   m_HaloSat = fetchDoubleParam("HaloSat");
+  m_HaloMode = fetchChoiceParam("HaloMode");
+  m_HaloSpreadR = fetchDoubleParam("HaloSpreadR");
+  m_HaloSpreadG = fetchDoubleParam("HaloSpreadG");
+  m_HaloSpreadB = fetchDoubleParam("HaloSpreadB");
 
   // Streak
   m_EnableStreak = fetchBooleanParam("EnableStreak");
@@ -519,12 +304,22 @@ CinematicPlugin::CinematicPlugin(OfxImageEffectHandle p_Handle)
   m_StreakThreshold = fetchDoubleParam("StreakThreshold");
   m_StreakLength = fetchDoubleParam("StreakLength");
   m_StreakTint = fetchDoubleParam("StreakTint");
+  m_StreakPoints = fetchChoiceParam("StreakPoints");
+  m_StreakAngle = fetchDoubleParam("StreakAngle");
+  m_StreakLength2 = fetchDoubleParam("StreakLength2");
+  m_StreakTint2 = fetchDoubleParam("StreakTint2");
+  m_StreakLength3 = fetchDoubleParam("StreakLength3");
+  m_StreakTint3 = fetchDoubleParam("StreakTint3");
+  m_StreakLength4 = fetchDoubleParam("StreakLength4");
+  m_StreakTint4 = fetchDoubleParam("StreakTint4");
 
   // Chromatic Aberration
   m_EnableCA = fetchBooleanParam("EnableCA");
   m_CAAmount = fetchDoubleParam("CAAmount");
   m_CACenterX = fetchDoubleParam("CACenterX");
   m_CACenterY = fetchDoubleParam("CACenterY");
+  m_CAMode = fetchChoiceParam("CAMode");
+  m_CABins = fetchIntParam("CABins");
 
   // Vignette
   m_EnableVignette = fetchBooleanParam("EnableVignette");
@@ -541,18 +336,30 @@ CinematicPlugin::CinematicPlugin(OfxImageEffectHandle p_Handle)
   m_VignetteTintR = fetchDoubleParam("VignetteTintR");
   m_VignetteTintG = fetchDoubleParam("VignetteTintG");
   m_VignetteTintB = fetchDoubleParam("VignetteTintB");
+
+  // Performance
+  m_Quality = fetchChoiceParam("QualityMode");
+  m_CacheBudget = fetchIntParam("CacheBudget");
+  m_DiskCacheMode = fetchChoiceParam("DiskCache");
+  m_HalfSources = fetchBooleanParam("HalfSources");
 }
 
 void CinematicPlugin::render(const OFX::RenderArguments &p_Args) {
   if ((m_DstClip->getPixelDepth() == OFX::eBitDepthFloat) &&
       (m_DstClip->getPixelComponents() == OFX::ePixelComponentRGBA)) {
+    std::unique_ptr<OFX::Image> dst(m_DstClip->fetchImage(p_Args.time));
+    std::unique_ptr<OFX::Image> src(m_SrcClip->fetchImage(p_Args.time));
+    if (!dst || !src)
+      OFX::throwSuiteStatusException(kOfxStatFailed);
+
     PipelineProcessor processor(*this);
     processor.setRenderScale(p_Args.renderScale.x);
-    processor.setDstImg(m_DstClip->fetchImage(p_Args.time));
-    processor.setSrcImg(m_SrcClip->fetchImage(p_Args.time));
+    processor.setDstImg(dst.get());
+    processor.setSrcImg(src.get());
     processor.setRenderWindow(p_Args.renderWindow);
     processor.setTime(p_Args.time);
-    processor.setSourceRoD(m_SrcClip->getRegionOfDefinition(p_Args.time));
+    const OfxRectD rod = m_SrcClip->getRegionOfDefinition(p_Args.time);
+    processor.setSourceRoD({rod.x1, rod.y1, rod.x2, rod.y2});
 
     // Populate Params
     double t = p_Args.time;
@@ -617,6 +424,9 @@ void CinematicPlugin::render(const OFX::RenderArguments &p_Args) {
     int gType = 0;
     m_GrainType->getValueAtTime(t, gType);
     processor.grain.grainType = gType;
+    int gModel = 0;
+    m_GrainModel->getValueAtTime(t, gModel);
+    processor.grain.model = gModel;
     processor.grain.amount = (float)m_GrainAmount->getValueAtTime(t);
     processor.grain.size = (float)m_GrainSize->getValueAtTime(t);
     processor.grain.shadowWeight =
@@ -630,6 +440,10 @@ void CinematicPlugin::render(const OFX::RenderArguments &p_Args) {
 
     processor.dither.enable = m_EnableDither->getValueAtTime(t);
     processor.dither.amount = m_DitherAmount->getValueAtTime(t);
+    int dType = 0;
+    m_DitherType->getValueAtTime(t, dType);
+    processor.dither.type = dType;
+    processor.dither.animate = m_DitherAnimate->getValueAtTime(t);
 
     processor.mist.enable = m_EnableMist->getValueAtTime(t);
     processor.mist.strength = m_MistAmount->getValueAtTime(t);
@@ -653,6 +467,12 @@ void CinematicPlugin::render(const OFX::RenderArguments &p_Args) {
     processor.glow.radius = m_GlowRadius->getValueAtTime(t);
     processor.glow.colorFidelity = m_GlowFidelity->getValueAtTime(t);
     processor.glow.warmth = m_GlowWarmth->getValueAtTime(t);
+    int glowMode = 0;
+    m_GlowMode->getValueAtTime(t, glowMode);
+    processor.glow.mode = glowMode;
+    processor.glow.octaves = m_BloomOctaves->getValueAtTime(t);
+    processor.glow.falloff = m_BloomFalloff->getValueAtTime(t);
+    processor.glow.tailTint = m_BloomTint->getValueAtTime(t);
 
     processor.sharp.enable = m_EnableSharp->getValueAtTime(t);
     int sType = 0;
@@ -673,17 +493,37 @@ void CinematicPlugin::render(const OFX::RenderArguments &p_Args) {
     processor.halo.warmth = m_HaloWarmth->getValueAtTime(t);
     processor.halo.radius = m_HaloRadius->getValueAtTime(t);
     processor.halo.saturation = m_HaloSat->getValueAtTime(t);
+    int haloMode = 0;
+    m_HaloMode->getValueAtTime(t, haloMode);
+    processor.halo.mode = haloMode;
+    processor.halo.spread[0] = m_HaloSpreadR->getValueAtTime(t);
+    processor.halo.spread[1] = m_HaloSpreadG->getValueAtTime(t);
+    processor.halo.spread[2] = m_HaloSpreadB->getValueAtTime(t);
 
     processor.streak.enable = m_EnableStreak->getValueAtTime(t);
     processor.streak.amount = m_StreakAmount->getValueAtTime(t);
     processor.streak.threshold = m_StreakThreshold->getValueAtTime(t);
     processor.streak.length = m_StreakLength->getValueAtTime(t);
     processor.streak.tint = m_StreakTint->getValueAtTime(t);
+    int sPoints = 0;
+    m_StreakPoints->getValueAtTime(t, sPoints);
+    processor.streak.points = sPoints;
+    processor.streak.angle = m_StreakAngle->getValueAtTime(t);
+    processor.streak.armLength[0] = m_StreakLength2->getValueAtTime(t);
+    processor.streak.armTint[0] = m_StreakTint2->getValueAtTime(t);
+    processor.streak.armLength[1] = m_StreakLength3->getValueAtTime(t);
+    processor.streak.armTint[1] = m_StreakTint3->getValueAtTime(t);
+    processor.streak.armLength[2] = m_StreakLength4->getValueAtTime(t);
+    processor.streak.armTint[2] = m_StreakTint4->getValueAtTime(t);
 
     processor.ca.enable = m_EnableCA->getValueAtTime(t);
     processor.ca.amount = m_CAAmount->getValueAtTime(t);
     processor.ca.centerX = m_CACenterX->getValueAtTime(t);
     processor.ca.centerY = m_CACenterY->getValueAtTime(t);
+    int caMode = 0;
+    m_CAMode->getValueAtTime(t, caMode);
+    processor.ca.mode = caMode;
+    processor.ca.bins = m_CABins->getValueAtTime(t);
 
     processor.vig.enable = m_EnableVignette->getValueAtTime(t);
     int vType = 0;
@@ -702,7 +542,85 @@ void CinematicPlugin::render(const OFX::RenderArguments &p_Args) {
     processor.vig.tintG = m_VignetteTintG->getValueAtTime(t);
     processor.vig.tintB = m_VignetteTintB->getValueAtTime(t);
 
+    // Quality tier — Normal follows the host's draft / interactive hints
+    int quality = eQualityNormal;
+    m_Quality->getValueAtTime(t, quality);
+    if (quality == eQualityNormal &&
+        (p_Args.renderQualityDraft || p_Args.interactiveRenderStatus))
+      quality = eQualityDraft;
+    processor.setQuality(quality);
+    processor.setHalfSources(m_HalfSources->getValue());
+    processor.setGrainCache(&m_GrainField);
+    processor.setScheduler(&blurScheduler());
+
+    // Frame cache — a hit costs one memcpy per row. The disk cache shares
+    // the key and is only live when CIE_DISK_CACHE_DIR is set.
+    const OfxRectI &win = p_Args.renderWindow;
+    FrameCache &cache = frameCache();
+    cache.setBudget((size_t)std::max(0, m_CacheBudget->getValue()) * 1024 *
+                    1024);
+    const bool useCache = cache.budget() > 0;
+    int diskMode = 0;
+    m_DiskCacheMode->getValue(diskMode);
+    const bool useDisk = diskMode != 0 && m_DiskCache.available();
+
+    FrameCache::Key key;
+    if (useCache || useDisk) {
+      key.paramHash = processor.paramHash();
+      key.sourceHash = sourceFingerprint(*src);
+      key.time = t;
+      key.x1 = win.x1;
+      key.y1 = win.y1;
+      key.x2 = win.x2;
+      key.y2 = win.y2;
+      key.scaleX = p_Args.renderScale.x;
+      key.scaleY = p_Args.renderScale.y;
+    }
+
+    if (useCache) {
+      std::shared_ptr<const FrameCache::Entry> hit = cache.find(key);
+      OFX::Log::print("CinematicImageEngine frame cache %s at t=%g "
+                      "(hits %llu, misses %llu, %.1f MB)",
+                      hit ? "hit" : "miss", t,
+                      (unsigned long long)cache.hits(),
+                      (unsigned long long)cache.misses(),
+                      (double)cache.bytesUsed() / (1024.0 * 1024.0));
+      if (hit) {
+        copyWindow(hit->pixels.data(), *dst, win);
+        return;
+      }
+    }
+
+    std::shared_ptr<FrameCache::Entry> entry;
+    if (useCache || useDisk) {
+      entry = std::make_shared<FrameCache::Entry>();
+      entry->width = win.x2 - win.x1;
+      entry->height = win.y2 - win.y1;
+      entry->pixels.resize((size_t)entry->width * entry->height * 4);
+    }
+
+    if (useDisk && m_DiskCache.fetch(key, entry->width, entry->height,
+                                     entry->pixels.data())) {
+      OFX::Log::print("CinematicImageEngine disk cache hit at t=%g", t);
+      copyWindow(entry->pixels.data(), *dst, win);
+      if (useCache)
+        cache.insert(key, std::move(entry));
+      return;
+    }
+
+    processor.prepareFrame();
     processor.process();
+
+    if (entry && !abort()) {
+      copyWindow(*dst, entry->pixels.data(), win);
+      if (useDisk)
+        m_DiskCache.insert(key, entry->width, entry->height,
+                           entry->pixels.data(),
+                           diskMode == 2 ? DiskCache::eHalf
+                                         : DiskCache::eFloat);
+      if (useCache)
+        cache.insert(key, std::move(entry));
+    }
   } else {
     OFX::throwSuiteStatusException(kOfxStatErrUnsupported);
   }
@@ -842,31 +760,75 @@ void CinematicPlugin::changedParam(const OFX::InstanceChangedArgs &p_Args,
 void CinematicPlugin::getRegionsOfInterest(
     const OFX::RegionsOfInterestArguments &p_Args,
     OFX::RegionOfInterestSetter &p_ROIS) {
-  double mistR = m_EnableMist->getValueAtTime(p_Args.time) ? 6.0 : 0.0;
+  // Each blur's full support (see BlurPyramid::reach). Normal may render
+  // either tier, so only a Draft setting gets Draft's smaller reach.
+  int quality = eQualityNormal;
+  m_Quality->getValueAtTime(p_Args.time, quality);
+  const bool draft = quality == eQualityDraft;
+  auto blurReach = [draft](double r) {
+    return (double)BlurPyramid::reach(std::max(1, (int)std::ceil(r)), draft);
+  };
+  double mistR =
+      m_EnableMist->getValueAtTime(p_Args.time) ? blurReach(6.0) : 0.0;
   double blurR = m_EnableBlur->getValueAtTime(p_Args.time)
-                     ? m_BlurRadius->getValueAtTime(p_Args.time)
+                     ? blurReach(m_BlurRadius->getValueAtTime(p_Args.time))
                      : 0.0;
   double glowR = m_EnableGlow->getValueAtTime(p_Args.time)
-                     ? m_GlowRadius->getValueAtTime(p_Args.time)
-                     : 0.0;
-  double haloR = m_EnableHalo->getValueAtTime(p_Args.time)
-                     ? m_HaloRadius->getValueAtTime(p_Args.time)
+                     ? blurReach(m_GlowRadius->getValueAtTime(p_Args.time))
                      : 0.0;
-  double sharpR = m_EnableSharp->getValueAtTime(p_Args.time) ? 2.0 : 0.0;
-  double streakR = m_EnableStreak->getValueAtTime(p_Args.time)
-                       ? m_StreakLength->getValueAtTime(p_Args.time) * 80.0
-                       : 0.0;
-  double caR = m_EnableCA->getValueAtTime(p_Args.time)
-                   ? m_CAAmount->getValueAtTime(p_Args.time) * 20.0
-                   : 0.0;
+  // Spectral Halation: as far as its widest channel
+  double haloR = 0.0;
+  if (m_EnableHalo->getValueAtTime(p_Args.time)) {
+    Halation::Params halo = {};
+    m_HaloMode->getValueAtTime(p_Args.time, halo.mode);
+    halo.spread[0] = m_HaloSpreadR->getValueAtTime(p_Args.time);
+    halo.spread[1] = m_HaloSpreadG->getValueAtTime(p_Args.time);
+    halo.spread[2] = m_HaloSpreadB->getValueAtTime(p_Args.time);
+    haloR = blurReach(m_HaloRadius->getValueAtTime(p_Args.time) *
+                      Halation::maxSpread(halo));
+  }
+  double sharpR = 0.0;
+  if (m_EnableSharp->getValueAtTime(p_Args.time)) {
+    Sharpening::Params sharp = {};
+    m_SharpType->getValueAtTime(p_Args.time, sharp.type);
+    sharp.radius = m_SharpRadius->getValueAtTime(p_Args.time);
+    sharpR = Sharpening::reach(sharp, 1.0);
+  }
+  // Along the streak's arms only (see AnamorphicStreak::reachXY)
+  int streakRX = 0, streakRY = 0;
+  if (m_EnableStreak->getValueAtTime(p_Args.time)) {
+    AnamorphicStreak::Params streak = {};
+    streak.length = m_StreakLength->getValueAtTime(p_Args.time);
+    m_StreakPoints->getValueAtTime(p_Args.time, streak.points);
+    streak.angle = m_StreakAngle->getValueAtTime(p_Args.time);
+    streak.armLength[0] = m_StreakLength2->getValueAtTime(p_Args.time);
+    streak.armLength[1] = m_StreakLength3->getValueAtTime(p_Args.time);
+    streak.armLength[2] = m_StreakLength4->getValueAtTime(p_Args.time);
+    AnamorphicStreak::reachXY(streak, 1.0, streakRX, streakRY);
+  }
+  // Exactly where the window's CA samples land (see
+  // ChromaticAberration::margins)
+  ChromaticAberration::Margins caM = {0.0, 0.0, 0.0, 0.0};
+  if (m_EnableCA->getValueAtTime(p_Args.time)) {
+    ChromaticAberration::Params ca = {};
+    ca.enable = true;
+    ca.amount = m_CAAmount->getValueAtTime(p_Args.time);
+    ca.centerX = m_CACenterX->getValueAtTime(p_Args.time);
+    ca.centerY = m_CACenterY->getValueAtTime(p_Args.time);
+    const OfxRectD rod = m_SrcClip->getRegionOfDefinition(p_Args.time);
+    const OfxRectD &roi = p_Args.regionOfInterest;
+    caM = ChromaticAberration::margins(ca, rod.x1, rod.y1, rod.x2 - rod.x1,
+                                       rod.y2 - rod.y1, roi.x1, roi.y1,
+                                       roi.x2, roi.y2);
+  }
 
-  double total = mistR + blurR + glowR + haloR + sharpR + streakR + caR + 10.0;
+  double total = mistR + blurR + glowR + haloR + sharpR + 10.0;
 
   OfxRectD srcRect = p_Args.regionOfInterest;
-  srcRect.x1 -= total;
-  srcRect.x2 += total;
-  srcRect.y1 -= total;
-  srcRect.y2 += total;
+  srcRect.x1 -= total + streakRX + caM.x1;
+  srcRect.x2 += total + streakRX + caM.x2;
+  srcRect.y1 -= total + streakRY + caM.y1;
+  srcRect.y2 += total + streakRY + caM.y2;
   p_ROIS.setRegionOfInterest(*m_SrcClip, srcRect);
 }
 
@@ -1277,6 +1239,17 @@ void CinematicPluginFactory::describeInContext(
     c->setParent(*group);
     page->addChild(*c);
 
+    c = p_Desc.defineChoiceParam("GrainModel");
+    c->setLabels("Grain Model", "Model", "Model");
+    c->appendOption("Classic");
+    c->appendOption("Organic");
+    c->setDefault(0);
+    c->setHint("Classic: one sharp value per grain cell. Organic: cell noise "
+               "mixed over three blur octaves weighted by the stock, then "
+               "smoothly upsampled.");
+    c->setParent(*group);
+    page->addChild(*c);
+
     auto *d = p_Desc.defineDoubleParam("GrainAmount");
     d->setLabels("Amount", "Amount", "Amt");
     d->setDigits(3);
@@ -1355,6 +1328,22 @@ void CinematicPluginFactory::describeInContext(
     d->setDefault(0.5);
     d->setParent(*group);
     page->addChild(*d);
+    auto *c = p_Desc.defineChoiceParam("DitherType");
+    c->setLabels("Dither Type", "Dither Type", "DType");
+    c->appendOption("Triangular");
+    c->appendOption("Blue Noise");
+    c->setDefault(0);
+    c->setHint("Triangular: hashed white noise. Blue Noise: tiled 128x128 "
+               "void-and-cluster mask, less visible at the same strength.");
+    c->setParent(*group);
+    page->addChild(*c);
+    p = p_Desc.defineBooleanParam("DitherAnimate");
+    p->setLabels("Animate Blue Noise", "Animate", "Anim");
+    p->setDefault(true);
+    p->setHint("Shift the blue-noise mask every frame so the pattern does "
+               "not sit still on static shots.");
+    p->setParent(*group);
+    page->addChild(*p);
   }
 
   // 8. Spatial Group (Mist, Blur, Glow, Sharp, Halo, Vignette)
@@ -1530,6 +1519,45 @@ void CinematicPluginFactory::describeInContext(
     d->setDisplayRange(-1.0, 1.0);
     d->setParent(*group);
     page->addChild(*d);
+    auto *gm = p_Desc.defineChoiceParam("GlowMode");
+    gm->setLabels("Glow Mode", "Glow Mode", "GMode");
+    gm->appendOption("Single");
+    gm->appendOption("Bloom");
+    gm->setDefault(CinematicGlow::eSingle);
+    gm->setHint("Single blurs the glow source once at Glow Radius. Bloom sums "
+                "octaves of halving radius up to Glow Radius for a lens-like "
+                "core and heavy tail.");
+    gm->setParent(*group);
+    page->addChild(*gm);
+    auto *bo = p_Desc.defineIntParam("BloomOctaves");
+    bo->setLabels("Bloom Octaves", "Bloom Oct", "BOct");
+    bo->setHint("Octaves in Bloom, the widest at Glow Radius.");
+    bo->setRange(4, 8);
+    bo->setDisplayRange(4, 8);
+    bo->setDefault(6);
+    bo->setParent(*group);
+    page->addChild(*bo);
+    d = p_Desc.defineDoubleParam("BloomFalloff");
+    d->setLabels("Bloom Falloff", "Bloom Fall", "BFall");
+    d->setHint("Weight of each octave relative to the next narrower one. "
+               "Below 1 the core dominates; above 1 the tail does.");
+    d->setDigits(3);
+    d->setIncrement(0.001);
+    d->setRange(0.0, 2.0);
+    d->setDisplayRange(0.0, 2.0);
+    d->setDefault(0.6);
+    d->setParent(*group);
+    page->addChild(*d);
+    d = p_Desc.defineDoubleParam("BloomTint");
+    d->setLabels("Bloom Tail Tint", "Bloom Tint", "BTint");
+    d->setHint("Warmth of the widest octave, ramping from none at the "
+               "narrowest (same response as Glow Warmth).");
+    d->setDigits(3);
+    d->setIncrement(0.001);
+    d->setRange(-1.0, 1.0);
+    d->setDisplayRange(-1.0, 1.0);
+    d->setParent(*group);
+    page->addChild(*d);
 
     // Sharpening
     p = p_Desc.defineBooleanParam("EnableSharp");
@@ -1659,6 +1687,49 @@ void CinematicPluginFactory::describeInContext(
     d->setDefault(1.0);
     d->setParent(*group);
     page->addChild(*d);
+    auto *hm = p_Desc.defineChoiceParam("HaloMode");
+    hm->setLabels("Halo Mode", "Halo Mode", "HMode");
+    hm->appendOption("Uniform");
+    hm->appendOption("Spectral");
+    hm->setDefault(Halation::eUniform);
+    hm->setHint("Uniform scatters every channel to Halo Radius. Spectral "
+                "scatters each channel to its own multiple of it, as film "
+                "does: red furthest, blue barely.");
+    hm->setParent(*group);
+    page->addChild(*hm);
+    d = p_Desc.defineDoubleParam("HaloSpreadR");
+    d->setLabels("Halo Red Spread", "Halo R Spr", "HSprR");
+    d->setHint("Spectral: this channel's scatter radius as a multiple of "
+               "Halo Radius.");
+    d->setDigits(3);
+    d->setIncrement(0.001);
+    d->setRange(0.1, 4.0);
+    d->setDisplayRange(0.1, 4.0);
+    d->setDefault(3.0);
+    d->setParent(*group);
+    page->addChild(*d);
+    d = p_Desc.defineDoubleParam("HaloSpreadG");
+    d->setLabels("Halo Green Spread", "Halo G Spr", "HSprG");
+    d->setHint("Spectral: this channel's scatter radius as a multiple of "
+               "Halo Radius.");
+    d->setDigits(3);
+    d->setIncrement(0.001);
+    d->setRange(0.1, 4.0);
+    d->setDisplayRange(0.1, 4.0);
+    d->setDefault(1.5);
+    d->setParent(*group);
+    page->addChild(*d);
+    d = p_Desc.defineDoubleParam("HaloSpreadB");
+    d->setLabels("Halo Blue Spread", "Halo B Spr", "HSprB");
+    d->setHint("Spectral: this channel's scatter radius as a multiple of "
+               "Halo Radius.");
+    d->setDigits(3);
+    d->setIncrement(0.001);
+    d->setRange(0.1, 4.0);
+    d->setDisplayRange(0.1, 4.0);
+    d->setDefault(0.5);
+    d->setParent(*group);
+    page->addChild(*d);
 
     // Vignette
     p = p_Desc.defineBooleanParam("EnableVignette");
@@ -1796,9 +1867,10 @@ void CinematicPluginFactory::describeInContext(
     page->addChild(*d);
     d = p_Desc.defineDoubleParam("StreakLength");
     d->setLabels("Streak Length", "Streak Len", "SkLen");
+    d->setHint("1.0 = 80 px. Type values up to 10 for frame-wide streaks.");
     d->setDigits(3);
     d->setIncrement(0.001);
-    d->setRange(0.0, 1.0);
+    d->setRange(0.0, 10.0);
     d->setDisplayRange(0.0, 1.0);
     d->setDefault(0.5);
     d->setParent(*group);
@@ -1812,6 +1884,49 @@ void CinematicPluginFactory::describeInContext(
     d->setDefault(0.0);
     d->setParent(*group);
     page->addChild(*d);
+    auto *sp = p_Desc.defineChoiceParam("StreakPoints");
+    sp->setLabels("Streak Points", "Points", "SkPts");
+    sp->appendOption("2 (Streak)");
+    sp->appendOption("4 (Cross)");
+    sp->appendOption("6 (Star)");
+    sp->appendOption("8 (Star)");
+    sp->setDefault(0);
+    sp->setHint("Arms through each highlight, spread evenly from the angle. "
+                "Length and Tint set the first; the others have their own.");
+    sp->setParent(*group);
+    page->addChild(*sp);
+    d = p_Desc.defineDoubleParam("StreakAngle");
+    d->setLabels("Streak Angle", "Streak Angle", "SkAng");
+    d->setHint("Rotation of the first arm from horizontal, in degrees.");
+    d->setDigits(1);
+    d->setIncrement(0.1);
+    d->setRange(-90.0, 90.0);
+    d->setDisplayRange(-90.0, 90.0);
+    d->setDefault(0.0);
+    d->setParent(*group);
+    page->addChild(*d);
+    const char *const armNames[3] = {"2", "3", "4"};
+    for (const char *arm : armNames) {
+      const std::string n(arm);
+      d = p_Desc.defineDoubleParam("StreakLength" + n);
+      d->setLabels("Arm " + n + " Length", "Arm " + n + " Len", "SkLen" + n);
+      d->setDigits(3);
+      d->setIncrement(0.001);
+      d->setRange(0.0, 10.0);
+      d->setDisplayRange(0.0, 1.0);
+      d->setDefault(0.5);
+      d->setParent(*group);
+      page->addChild(*d);
+      d = p_Desc.defineDoubleParam("StreakTint" + n);
+      d->setLabels("Arm " + n + " Tint", "Arm " + n + " Tint", "SkTint" + n);
+      d->setDigits(3);
+      d->setIncrement(0.001);
+      d->setRange(0.0, 1.0);
+      d->setDisplayRange(0.0, 1.0);
+      d->setDefault(0.0);
+      d->setParent(*group);
+      page->addChild(*d);
+    }
 
     // Chromatic Aberration
     p = p_Desc.defineBooleanParam("EnableCA");
@@ -1844,6 +1959,73 @@ void CinematicPluginFactory::describeInContext(
     d->setDefault(0.0);
     d->setParent(*group);
     page->addChild(*d);
+    auto *cm = p_Desc.defineChoiceParam("CAMode");
+    cm->setLabels("CA Mode", "CA Mode", "CAMode");
+    cm->appendOption("Classic");
+    cm->appendOption("Spectral");
+    cm->setDefault(ChromaticAberration::eClassic);
+    cm->setHint("Classic shifts R out and B in. Spectral spreads each pixel "
+                "over wavelength bins, each at its own radial scale, for a "
+                "continuous fringe.");
+    cm->setParent(*group);
+    page->addChild(*cm);
+    auto *cb = p_Desc.defineIntParam("CABins");
+    cb->setLabels("CA Spectral Bins", "CA Bins", "CABins");
+    cb->setHint("Wavelength samples for Spectral. Cost grows linearly.");
+    cb->setRange(3, 8);
+    cb->setDisplayRange(3, 8);
+    cb->setDefault(5);
+    cb->setParent(*group);
+    page->addChild(*cb);
+  }
+
+  // 9. Performance
+  {
+    OFX::GroupParamDescriptor *group =
+        p_Desc.defineGroupParam("GroupPerformance");
+    group->setLabels("Performance", "Performance", "Perf");
+    page->addChild(*group);
+    auto *c = p_Desc.defineChoiceParam("QualityMode");
+    c->setLabels("Quality", "Quality", "Quality");
+    c->appendOption("Draft");
+    c->appendOption("Normal");
+    c->appendOption("Final");
+    c->setDefault(eQualityNormal);
+    c->setAnimates(false);
+    c->setParent(*group);
+    page->addChild(*c);
+    auto *i = p_Desc.defineIntParam("CacheBudget");
+    i->setLabels("Frame Cache (MB)", "Cache MB", "Cache");
+    i->setHint("Memory budget for re-used rendered frames, shared by every "
+               "instance of the effect; the last value rendered with "
+               "applies. 0 disables.");
+    i->setRange(0, 16384);
+    i->setDisplayRange(0, 4096);
+    i->setDefault(512);
+    i->setAnimates(false);
+    i->setParent(*group);
+    page->addChild(*i);
+    c = p_Desc.defineChoiceParam("DiskCache");
+    c->setLabels("Disk Cache", "Disk Cache", "Disk");
+    c->setHint("Persistent render cache in $CIE_DISK_CACHE_DIR, size-limited "
+               "by $CIE_DISK_CACHE_MB. Half halves the footprint at fp16 "
+               "precision.");
+    c->appendOption("Off");
+    c->appendOption("Float");
+    c->appendOption("Half");
+    c->setDefault(0);
+    c->setAnimates(false);
+    c->setParent(*group);
+    page->addChild(*c);
+    auto *b = p_Desc.defineBooleanParam("HalfSources");
+    b->setLabels("FP16 Effect Buffers", "FP16 Effects", "FP16");
+    b->setHint("Keep the Mist, Glow, Streak and Halation layers in half "
+               "precision while they are blurred. Faster on large frames; "
+               "output changes by about one half-float step.");
+    b->setDefault(false);
+    b->setAnimates(false);
+    b->setParent(*group);
+    page->addChild(*b);
   }
 }
 
@@ -3,6 +3,9 @@
 #include "ofxsImageEffect.h"
 #include "ofxsProcessing.H"
 
+#include "DiskCache.h"
+#include "GrainField.h"
+
 // Per-pixel modules
 #include "ColorEnergyEngine.h"
 #include "ColorIngestTweaks.h"
@@ -122,6 +125,7 @@ public:
   OFX::DoubleParam *m_GrainMidWeight;
   OFX::DoubleParam *m_GrainHighlightWeight;
   OFX::ChoiceParam *m_GrainType;
+  OFX::ChoiceParam *m_GrainModel;
   OFX::BooleanParam *m_GrainChromatic;
   OFX::DoubleParam *m_GrainTemporalSpeed;
 
@@ -130,6 +134,8 @@ public:
   // ==========================================
   OFX::BooleanParam *m_EnableDither;
   OFX::DoubleParam *m_DitherAmount;
+  OFX::ChoiceParam *m_DitherType;
+  OFX::BooleanParam *m_DitherAnimate;
 
   // ==========================================
   // 9. Spatial — Mist
@@ -162,6 +168,10 @@ public:
   OFX::DoubleParam *m_GlowRadius;
   OFX::DoubleParam *m_GlowFidelity;
   OFX::DoubleParam *m_GlowWarmth;
+  OFX::ChoiceParam *m_GlowMode;
+  OFX::IntParam *m_BloomOctaves;
+  OFX::DoubleParam *m_BloomFalloff;
+  OFX::DoubleParam *m_BloomTint;
 
   // ==========================================
   // 12. Spatial — Anamorphic Streak
@@ -171,6 +181,14 @@ public:
   OFX::DoubleParam *m_StreakThreshold;
   OFX::DoubleParam *m_StreakLength;
   OFX::DoubleParam *m_StreakTint;
+  OFX::ChoiceParam *m_StreakPoints;
+  OFX::DoubleParam *m_StreakAngle;
+  OFX::DoubleParam *m_StreakLength2;
+  OFX::DoubleParam *m_StreakTint2;
+  OFX::DoubleParam *m_StreakLength3;
+  OFX::DoubleParam *m_StreakTint3;
+  OFX::DoubleParam *m_StreakLength4;
+  OFX::DoubleParam *m_StreakTint4;
 
   // ==========================================
   // 13. Spatial — Sharpening
@@ -195,6 +213,10 @@ public:
   OFX::DoubleParam *m_HaloWarmth;
   OFX::DoubleParam *m_HaloRadius;
   OFX::DoubleParam *m_HaloSat;
+  OFX::ChoiceParam *m_HaloMode;
+  OFX::DoubleParam *m_HaloSpreadR;
+  OFX::DoubleParam *m_HaloSpreadG;
+  OFX::DoubleParam *m_HaloSpreadB;
 
   // ==========================================
   // 15. Spatial — Chromatic Aberration
@@ -203,6 +225,8 @@ public:
   OFX::DoubleParam *m_CAAmount;
   OFX::DoubleParam *m_CACenterX;
   OFX::DoubleParam *m_CACenterY;
+  OFX::ChoiceParam *m_CAMode;
+  OFX::IntParam *m_CABins;
 
   // ==========================================
   // 16. Spatial — Vignette
@@ -222,7 +246,18 @@ public:
   OFX::DoubleParam *m_VignetteTintG;
   OFX::DoubleParam *m_VignetteTintB;
 
+  // ==========================================
+  // 17. Performance
+  // ==========================================
+  OFX::ChoiceParam *m_Quality;
+  OFX::IntParam *m_CacheBudget;
+  OFX::ChoiceParam *m_DiskCacheMode;
+  OFX::BooleanParam *m_HalfSources;
+
 private:
   OFX::Clip *m_DstClip;
   OFX::Clip *m_SrcClip;
+
+  DiskCache m_DiskCache;
+  GrainField m_GrainField;
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include "FastMath.h"
 #include "Utils.h"
 
 namespace ColorEnergyEngine {
@@ -84,7 +85,7 @@ inline void process(float *r, float *g, float *b, const Params &p) {
 
     float sat = std::sqrt(cr * cr + cg * cg + cb * cb);
     if (sat > 0.0001f) {
-      float satNew = std::pow(sat, (float)p.density);
+      float satNew = FastMath::pow(sat, (float)p.density);
       // Blend density effect based on shadow/highlight controls?
       // Prompt says "Attenuated by luminance extremes".
       // Let's reuse the attenuation calculated above or similar.
@@ -1,4 +1,5 @@
 #pragma once
+#include "FastMath.h"
 #include "Utils.h"
 
 namespace ColorIngestTweaks {
@@ -52,7 +53,7 @@ inline void process(float *r, float *g, float *b, const Params &p) {
     float cMag = std::sqrt(cr * cr + cg * cg + cb * cb);
     float limit = (float)p.chromaCeiling;
     if (cMag > limit && limit > 0.001f) {
-      float compressed = limit + std::tanh(cMag - limit) * 0.1f;
+      float compressed = limit + FastMath::tanh(cMag - limit) * 0.1f;
       float scale = compressed / cMag;
       *r = luma + cr * scale;
       *g = luma + cg * scale;
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Coarse per-frame 3D table for the Stage 0 colour chain.
+ *
+ * Used by the Draft quality tier: the position-independent modules
+ * (CIT -> PCR -> Tonal -> Energy -> HLP -> Split) are baked once per frame
+ * into a 33^3 RGB table and evaluated with trilinear interpolation.
+ *
+ * Each axis uses a log2 shaper over [0, kDomainMax] so that shadows get as
+ * many nodes per stop as highlights. Pixels outside the domain (negative or
+ * superwhite beyond kDomainMax) are reported as misses and the caller falls
+ * back to the exact chain.
+ */
+namespace ColorTable {
+
+static constexpr int kSize = 33;
+static constexpr float kDomainMax = 16.0f;
+static constexpr float kShaperOffset = 1.0f / 64.0f;
+
+struct Table {
+  std::vector<float> data; // kSize^3 RGB triplets, R fastest
+};
+
+inline float shaperMin() { return std::log2(kShaperOffset); }
+inline float shaperMax() { return std::log2(kDomainMax + kShaperOffset); }
+
+// Linear value -> table coordinate in [0, kSize - 1]
+inline float toIndex(float v) {
+  const float lo = shaperMin();
+  const float scale = (float)(kSize - 1) / (shaperMax() - lo);
+  return (std::log2(v + kShaperOffset) - lo) * scale;
+}
+
+// Table coordinate -> linear value (inverse of toIndex)
+inline float fromIndex(int i) {
+  const float lo = shaperMin();
+  const float t = (float)i / (float)(kSize - 1);
+  return std::exp2(lo + t * (shaperMax() - lo)) - kShaperOffset;
+}
+
+// Bake fn(r, g, b) over the full lattice. fn modifies its arguments in place.
+template <class Fn> inline void bake(Table &table, Fn fn) {
+  table.data.resize((size_t)kSize * kSize * kSize * 3);
+  float axis[kSize];
+  for (int i = 0; i < kSize; ++i)
+    axis[i] = fromIndex(i);
+
+  float *out = table.data.data();
+  for (int b = 0; b < kSize; ++b) {
+    for (int g = 0; g < kSize; ++g) {
+      for (int r = 0; r < kSize; ++r) {
+        float R = axis[r], G = axis[g], B = axis[b];
+        fn(R, G, B);
+        out[0] = R;
+        out[1] = G;
+        out[2] = B;
+        out += 3;
+      }
+    }
+  }
+}
+
+// Trilinear lookup. Returns false (leaving r, g, b untouched) when the pixel
+// lies outside the baked domain.
+inline bool lookup(const Table &table, float &r, float &g, float &b) {
+  if (r < 0.0f || g < 0.0f || b < 0.0f || r > kDomainMax || g > kDomainMax ||
+      b > kDomainMax)
+    return false;
+
+  const float fr = toIndex(r), fg = toIndex(g), fb = toIndex(b);
+  const int r0 = std::min((int)fr, kSize - 2);
+  const int g0 = std::min((int)fg, kSize - 2);
+  const int b0 = std::min((int)fb, kSize - 2);
+  const float tr = fr - (float)r0, tg = fg - (float)g0, tb = fb - (float)b0;
+
+  const int sG = kSize * 3;
+  const int sB = kSize * kSize * 3;
+  const float *p = table.data.data() + b0 * sB + g0 * sG + r0 * 3;
+
+  float out[3];
+  for (int c = 0; c < 3; ++c) {
+    float c00 = p[c] + (p[3 + c] - p[c]) * tr;
+    float c10 = p[sG + c] + (p[sG + 3 + c] - p[sG + c]) * tr;
+    float c01 = p[sB + c] + (p[sB + 3 + c] - p[sB + c]) * tr;
+    float c11 = p[sB + sG + c] + (p[sB + sG + 3 + c] - p[sB + sG + c]) * tr;
+    float c0 = c00 + (c10 - c00) * tg;
+    float c1 = c01 + (c11 - c01) * tg;
+    out[c] = c0 + (c1 - c0) * tb;
+  }
+  r = out[0];
+  g = out[1];
+  b = out[2];
+  return true;
+}
+
+} // namespace ColorTable
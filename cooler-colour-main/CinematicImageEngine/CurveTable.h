@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * @brief Per-frame 1D table for scalar luminance curves.
+ *
+ * Used for the Tonal Engine curve and Highlight Protection roll-off: both
+ * are functions of one value with parameters fixed for the frame, so they
+ * are baked once and evaluated with one load pair and a lerp.
+ *
+ * Nodes are log-spaced by indexing on the float's bit pattern: the
+ * exponent picks the stop and the top kMantBits mantissa bits pick one of
+ * 2^kMantBits evenly spaced nodes inside it. Within a stop the nodes are
+ * linear in value, so linear interpolation needs no log2 and is exact for
+ * linear segments. Values outside [2^kMinExp, 2^kMaxExp) — deep blacks,
+ * negatives, superwhites — are reported as misses and the caller evaluates
+ * the curve directly.
+ *
+ * Segments the lerp cannot follow (a kink at the tonal pivot, a step in
+ * the soft clip) are found at bake time by checking sub-samples against
+ * kBakeTolerance and are also reported as misses. The margin below
+ * kTolerance covers rounding in the curve and the lerp between
+ * sub-samples, so every hit is within kTolerance of the curve
+ * (tests/CurveTableTest checks this over the whole domain).
+ */
+namespace CurveTable {
+
+static constexpr int kMantBits = 7; // 128 nodes per stop
+static constexpr int kMinExp = -14; // 6.1e-5
+static constexpr int kMaxExp = 8;   // 256
+static constexpr int kShift = 23 - kMantBits;
+static constexpr int kNodes = (kMaxExp - kMinExp) << kMantBits;
+static constexpr float kTolerance = 1e-5f; // relative
+static constexpr float kBakeTolerance = 0.9f * kTolerance;
+
+struct Table {
+  std::vector<float> data;    // kNodes + 1 values; empty = not baked
+  std::vector<uint8_t> exact; // per segment: evaluate directly
+};
+
+inline uint32_t bits(float v) {
+  uint32_t u;
+  std::memcpy(&u, &v, sizeof(u));
+  return u;
+}
+
+inline float fromBits(uint32_t u) {
+  float v;
+  std::memcpy(&v, &u, sizeof(v));
+  return v;
+}
+
+inline uint32_t baseBits() { return (uint32_t)(127 + kMinExp) << 23; }
+
+// Bake fn(v) -> float at every node, and flag segments where linear
+// interpolation misses fn by more than kBakeTolerance at any of 8
+// sub-samples
+template <class Fn> inline void bake(Table &table, Fn fn) {
+  const int kSubSamples = 8;
+  table.data.resize(kNodes + 1);
+  table.exact.assign(kNodes, 0);
+  for (int i = 0; i <= kNodes; ++i)
+    table.data[i] = fn(fromBits(baseBits() + ((uint32_t)i << kShift)));
+
+  for (int i = 0; i < kNodes; ++i) {
+    const float v0 = fromBits(baseBits() + ((uint32_t)i << kShift));
+    const float v1 = fromBits(baseBits() + ((uint32_t)(i + 1) << kShift));
+    const float y0 = table.data[i];
+    const float y1 = table.data[i + 1];
+    for (int s = 1; s < kSubSamples; ++s) {
+      const float t = (float)s / (float)kSubSamples;
+      const float y = fn(v0 + (v1 - v0) * t);
+      const float err = std::fabs(y0 + (y1 - y0) * t - y);
+      if (!(err <= kBakeTolerance * std::fabs(y))) {
+        table.exact[i] = 1;
+        break;
+      }
+    }
+  }
+}
+
+// Interpolated fn(v). Returns false (leaving out untouched) outside the
+// baked domain or when the table is empty.
+inline bool lookup(const Table &table, float v, float &out) {
+  if (!(v >= fromBits(baseBits())) || v >= (float)(1 << kMaxExp) ||
+      table.data.empty())
+    return false;
+  const uint32_t pos = bits(v) - baseBits();
+  const uint32_t i = pos >> kShift;
+  if (table.exact[i])
+    return false;
+  const float t =
+      (float)(pos & ((1u << kShift) - 1)) * (1.0f / (float)(1u << kShift));
+  const float *p = table.data.data() + i;
+  out = p[0] + (p[1] - p[0]) * t;
+  return true;
+}
+
+} // namespace CurveTable
@@ -0,0 +1,281 @@
+#pragma once
+
+#include "FrameCache.h"
+#include "Half.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Persistent on-disk cache of rendered windows.
+ *
+ * Shares FrameCache::Key with the in-memory cache. Each entry is one file,
+ * named after the key digest, holding a small header (which repeats the full
+ * key to reject digest collisions) followed by the RGBA payload as float32
+ * or binary16. kVersion covers only this file format; the key's paramHash
+ * carries the render algorithm version (Pipeline::kRenderVersion), so an
+ * upgraded build misses on frames an older one left behind.
+ *
+ * Safe for several render nodes sharing a directory:
+ *   - Writes go to a unique temp file that is rename()d into place, so
+ *     readers only ever see complete blobs.
+ *   - Reads mmap the file; a concurrent unlink by another node's trim
+ *     leaves the mapping valid.
+ *   - The LRU clock is the file mtime, bumped on every hit.
+ *
+ * Configured from the environment so no text entry is needed in the UI:
+ *   CIE_DISK_CACHE_DIR   cache directory (cache disabled when unset)
+ *   CIE_DISK_CACHE_MB    size limit in MB (default 20480)
+ *
+ * POSIX only; a no-op on Windows.
+ */
+class DiskCache {
+public:
+  enum Format { eFloat = 0, eHalf = 1 };
+
+  DiskCache() : _limitBytes(0), _insertsSinceTrim(0) {
+    const char *dir = std::getenv("CIE_DISK_CACHE_DIR");
+    if (dir && *dir) {
+      _dir = dir;
+      if (_dir.back() != '/')
+        _dir += '/';
+    }
+    const char *mb = std::getenv("CIE_DISK_CACHE_MB");
+    const long long limitMB = mb ? std::atoll(mb) : 20480;
+    _limitBytes = (uint64_t)std::max(0LL, limitMB) * 1024ull * 1024ull;
+  }
+
+  bool available() const {
+#ifdef _WIN32
+    return false;
+#else
+    return !_dir.empty() && _limitBytes > 0;
+#endif
+  }
+
+  const std::string &directory() const { return _dir; }
+
+  // Reads a cached window into `dst` (width * height RGBA floats).
+  bool fetch(const FrameCache::Key &key, int width, int height,
+             float *dst) const {
+#ifdef _WIN32
+    return false;
+#else
+    if (!available())
+      return false;
+
+    const std::string path = pathFor(key);
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+
+    struct stat st;
+    bool ok = false;
+    if (::fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(Header)) {
+      void *map = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED,
+                         fd, 0);
+      if (map != MAP_FAILED) {
+        ok = decode(static_cast<const unsigned char *>(map),
+                    (size_t)st.st_size, key, width, height, dst);
+        ::munmap(map, (size_t)st.st_size);
+      }
+    }
+    if (ok)
+      ::futimens(fd, nullptr); // bump LRU clock
+    ::close(fd);
+    return ok;
+#endif
+  }
+
+  // Writes a rendered window atomically, then trims the directory to the
+  // size limit every few inserts.
+  void insert(const FrameCache::Key &key, int width, int height,
+              const float *src, Format format) {
+#ifndef _WIN32
+    if (!available())
+      return;
+
+    const size_t n = (size_t)width * height * 4;
+    Header hdr;
+    std::memset(&hdr, 0, sizeof(hdr));
+    std::memcpy(hdr.magic, kMagic, sizeof(hdr.magic));
+    hdr.version = kVersion;
+    hdr.format = (uint32_t)format;
+    hdr.width = width;
+    hdr.height = height;
+    hdr.key = key;
+
+    std::vector<unsigned char> blob(sizeof(Header) +
+                                    n * (format == eHalf ? 2 : 4));
+    std::memcpy(blob.data(), &hdr, sizeof(hdr));
+    unsigned char *payload = blob.data() + sizeof(Header);
+    if (format == eHalf) {
+      std::vector<uint16_t> tmp(n);
+      Half::fromFloat(src, tmp.data(), n);
+      std::memcpy(payload, tmp.data(), n * 2);
+    } else {
+      std::memcpy(payload, src, n * 4);
+    }
+
+    ::mkdir(_dir.c_str(), 0777);
+
+    // Unique per host, process and thread (stack address of `blob`)
+    const std::string finalPath = pathFor(key);
+    char host[64] = {0};
+    ::gethostname(host, sizeof(host) - 1);
+    char suffix[160];
+    std::snprintf(suffix, sizeof(suffix), ".tmp.%s.%ld.%lx", host,
+                  (long)::getpid(), (unsigned long)(uintptr_t)&blob);
+    const std::string tmpPath = finalPath + suffix;
+
+    FILE *f = std::fopen(tmpPath.c_str(), "wb");
+    if (!f)
+      return;
+    const bool written = std::fwrite(blob.data(), 1, blob.size(), f) ==
+                         blob.size();
+    const bool closed = std::fclose(f) == 0;
+    if (!written || !closed || std::rename(tmpPath.c_str(),
+                                           finalPath.c_str()) != 0) {
+      std::remove(tmpPath.c_str());
+      return;
+    }
+
+    bool trim = false;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (++_insertsSinceTrim >= kTrimInterval || _insertsSinceTrim == 1) {
+        trim = true;
+        _insertsSinceTrim = 1;
+      }
+    }
+    if (trim)
+      trimToLimit();
+#endif
+  }
+
+private:
+  static constexpr const char *kMagic = "CIEDISK1";
+  static constexpr uint32_t kVersion = 1;
+  static constexpr int kTrimInterval = 16;
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t format;
+    int32_t width;
+    int32_t height;
+    FrameCache::Key key;
+  };
+
+  std::string pathFor(const FrameCache::Key &key) const {
+    uint64_t h = FrameCache::hashValue(key.paramHash, kVersion);
+    h = FrameCache::hashValue(key.sourceHash, h);
+    h = FrameCache::hashValue(key.time, h);
+    const int win[4] = {key.x1, key.y1, key.x2, key.y2};
+    h = FrameCache::hashBytes(win, sizeof(win), h);
+    h = FrameCache::hashValue(key.scaleX, h);
+    h = FrameCache::hashValue(key.scaleY, h);
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.ciec", (unsigned long long)h);
+    return _dir + name;
+  }
+
+  static bool decode(const unsigned char *data, size_t size,
+                     const FrameCache::Key &key, int width, int height,
+                     float *dst) {
+    Header hdr;
+    std::memcpy(&hdr, data, sizeof(hdr));
+    if (std::memcmp(hdr.magic, kMagic, sizeof(hdr.magic)) != 0 ||
+        hdr.version != kVersion || hdr.width != width ||
+        hdr.height != height || !(hdr.key == key))
+      return false;
+
+    const size_t n = (size_t)width * height * 4;
+    const unsigned char *payload = data + sizeof(Header);
+    if (hdr.format == eHalf) {
+      if (size < sizeof(Header) + n * 2)
+        return false;
+      for (size_t i = 0; i < n; ++i) {
+        uint16_t h;
+        std::memcpy(&h, payload + i * 2, 2);
+        dst[i] = Half::toFloat(h);
+      }
+      return true;
+    }
+    if (hdr.format == eFloat && size >= sizeof(Header) + n * 4) {
+      std::memcpy(dst, payload, n * 4);
+      return true;
+    }
+    return false;
+  }
+
+#ifndef _WIN32
+  // Deletes least-recently-used blobs until the directory is back under
+  // 90% of the limit. Also sweeps temp files abandoned by crashed writers.
+  void trimToLimit() {
+    struct File {
+      std::string path;
+      time_t mtime;
+      uint64_t size;
+    };
+    std::vector<File> files;
+    uint64_t total = 0;
+    const time_t now = std::time(nullptr);
+
+    DIR *d = ::opendir(_dir.c_str());
+    if (!d)
+      return;
+    while (struct dirent *e = ::readdir(d)) {
+      const std::string name = e->d_name;
+      const std::string path = _dir + name;
+      struct stat st;
+      if (::stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+        continue;
+      if (name.find(".ciec.tmp.") != std::string::npos) {
+        if (now - st.st_mtime > 3600)
+          ::unlink(path.c_str());
+        continue;
+      }
+      if (name.size() < 5 || name.compare(name.size() - 5, 5, ".ciec") != 0)
+        continue;
+      files.push_back(File{path, st.st_mtime, (uint64_t)st.st_size});
+      total += (uint64_t)st.st_size;
+    }
+    ::closedir(d);
+
+    if (total <= _limitBytes)
+      return;
+
+    std::sort(files.begin(), files.end(),
+              [](const File &a, const File &b) { return a.mtime < b.mtime; });
+    const uint64_t target = _limitBytes / 10 * 9;
+    for (const File &f : files) {
+      if (total <= target)
+        break;
+      if (::unlink(f.path.c_str()) == 0)
+        total -= f.size;
+    }
+  }
+#endif
+
+  std::string _dir;
+  uint64_t _limitBytes;
+  std::mutex _mutex;
+  int _insertsSinceTrim;
+};
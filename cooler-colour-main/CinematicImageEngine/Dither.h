@@ -1,14 +1,51 @@
 #pragma once
 
+#include "BlueNoiseMask.h"
+
+#include <cmath>
 #include <cstdint>
+#include <vector>
 
 namespace Dither {
 
+enum Type {
+  eTriangular = 0, // hashed triangular-PDF white noise
+  eBlueNoise       // tiled void-and-cluster mask
+};
+
 struct Params {
   bool enable;
   double amount; // 0..1, dither strength
+  int type;      // Type
+  bool animate;  // Blue noise: shift the mask every frame
 };
 
+// ============================================================================
+// BLUE-NOISE MASK
+// 128x128 void-and-cluster threshold map (Ulichney 1993), toroidal so it
+// tiles seamlessly. The ranks are precomputed (BlueNoiseMask.h, from
+// tools/GenBlueNoiseMask.cpp): the build scans the tile once per rank,
+// about 1.6 s at -O2 / -O3, which on first use stalled a render and every
+// thread waiting on it. A fixed table also no longer depends on how the
+// compiler rounds the energy sums. Expanded once to 64 KB of floats,
+// uniform over [-0.5, 0.5).
+// ============================================================================
+static const int kMaskSize = 128;
+static const int kMaskMask = kMaskSize - 1;
+
+// Thread-safe lazy initialisation (C++11 function-local static)
+inline const float *blueNoiseMask() {
+  static const std::vector<float> mask = [] {
+    const int n = kMaskSize * kMaskSize;
+    const uint16_t *rank = blueNoiseRanks();
+    std::vector<float> m(n);
+    for (int i = 0; i < n; ++i)
+      m[i] = ((float)rank[i] + 0.5f) / (float)n - 0.5f;
+    return m;
+  }();
+  return mask.data();
+}
+
 // Fast spatial hash for dithering — returns -0.5..+0.5
 inline float ditherHash(int x, int y, uint32_t seed) {
   uint32_t h = (uint32_t)x * 374761393u + (uint32_t)y * 668265263u;
@@ -17,12 +54,33 @@ inline float ditherHash(int x, int y, uint32_t seed) {
   return (float)(h & 0x00FFFFFF) / (float)0x01000000 - 0.5f;
 }
 
-// Triangular-PDF dither to break banding in 8/10-bit output.
+// Dither to break banding in 8/10-bit output: triangular-PDF white noise or
+// the blue-noise mask. `frame` only matters for animated blue noise.
 inline void process(float *r, float *g, float *b, int x, int y,
-                    const Params &params) {
+                    const Params &params, int frame = 0) {
   if (!params.enable || params.amount <= 0.0)
     return;
 
+  if (params.type == eBlueNoise) {
+    // One table load per channel. Channels read the mask at fixed offsets
+    // so their errors stay decorrelated; animation walks the tile along a
+    // long-period diagonal. The uniform mask is scaled by sqrt(2) to match
+    // the triangular PDF's RMS.
+    const float *mask = blueNoiseMask();
+    const int ox = params.animate ? frame * 41 : 0;
+    const int oy = params.animate ? frame * 73 : 0;
+    const float scale = (float)params.amount * (1.41421356f / 512.0f);
+    *r += mask[((y + oy) & kMaskMask) * kMaskSize + ((x + ox) & kMaskMask)] *
+          scale;
+    *g += mask[((y + oy + 59) & kMaskMask) * kMaskSize +
+               ((x + ox + 31) & kMaskMask)] *
+          scale;
+    *b += mask[((y + oy + 17) & kMaskMask) * kMaskSize +
+               ((x + ox + 89) & kMaskMask)] *
+          scale;
+    return;
+  }
+
   // Triangular-PDF: sum of two uniform — better perceptual quality
   float nR = ditherHash(x, y, 0xA1B2C3D4u) + ditherHash(x + 1, y, 0xA1B2C3D4u);
   float nG = ditherHash(x, y, 0xE5F6A7B8u) + ditherHash(x + 1, y, 0xE5F6A7B8u);
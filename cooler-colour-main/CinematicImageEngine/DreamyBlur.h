@@ -1,8 +1,11 @@
 #pragma once
 
+#include "BlurPyramid.h"
+#include "PlanarImage.h"
 #include "Utils.h"
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace DreamyBlur {
 
@@ -31,17 +34,14 @@ inline float softLight(float base, float blend) {
   }
 }
 
-inline void applyDreamyBlur(float &r, float &g, float &b, float blurredR,
-                            float blurredG, float blurredB,
+// lumaBlend is the luma of the blurred image around the pixel
+inline void applyDreamyBlur(float &r, float &g, float &b, float lumaBlend,
                             const Params &params) {
   if (!params.enable)
     return;
 
-  // 1. Base = Input (r,g,b). Blend = Blurred (blurredR,g,b).
-  // Compute Luminances
+  // 1. Base = Input (r,g,b). Blend = blurred luma.
   float lumaBase = 0.2126f * r + 0.7152f * g + 0.0722f * b;
-  float lumaBlend =
-      0.2126f * blurredR + 0.7152f * blurredG + 0.0722f * blurredB;
 
   // Apply Soft Light to Luminance
   float lumaResult = softLight(lumaBase, lumaBlend);
@@ -79,4 +79,121 @@ inline void applyDreamyBlur(float &r, float &g, float &b, float blurredR,
   b = Utils::mix(b, slB, finalMix);
 }
 
+// ============================================================================
+// Blurred luma — reduced resolution, joint-bilateral upsample
+//
+// The blend only reads the luma of the blurred image, and luma is linear in
+// R, G and B, so one luma plane is blurred instead of three colour planes.
+// The blur runs on the luma's BlurPyramid level for the radius (half
+// resolution from 16 px, a further 2x per doubling) and comes back by a
+// joint-bilateral upsample. Each pixel blends its four nearest coarse
+// samples with bilinear weights, each scaled down as the coarse luma under
+// it differs from the pixel's own, so blurred values do not step or bleed
+// across edges the upsample's footprint straddles. The upsample and the
+// blend run together, row by row.
+//
+// The luma is scene-linear, so the difference is taken relative to the two
+// values, (gl - L) / (|gl| + |L| + kRangeFloor): the tanh of half their log
+// ratio, so an edge stops taps the same way at any exposure. The floor
+// keeps grain in near-black from reading as edges. The coarse grid is the
+// buffer's, which the pipeline aligns to the global 32 px grid, so it does
+// not move with the render window.
+// ============================================================================
+
+static constexpr float kRangeSigma = 0.2f;  // Relative difference halving a tap
+static constexpr float kRangeFloor = 0.05f; // Luma below which it turns absolute
+
+// Blend img in place over [x0, x1) x [y0, y1) against its blur of the given
+// radius (Draft: one box pass); the rest of img is read as the blur's
+// neighbourhood. scratch holds two planes of img's size, tmp one.
+inline void process(PlanarImage &img, PlanarImage &scratch, PlanarImage &tmp,
+                    int x0, int y0, int x1, int y1, int radius, bool draft,
+                    const Params &params,
+                    const Utils::Scheduler *sched = nullptr) {
+  const int w = img.width();
+  const int h = img.height();
+  float *const r = img.plane(0);
+  float *const g = img.plane(1);
+  float *const b = img.plane(2);
+  float *const luma = scratch.plane(0);
+  const int rows = 64;
+  Utils::parallelFor(sched, (h + rows - 1) / rows, [&](int chunk) {
+    const size_t i1 = std::min((size_t)(chunk + 1) * rows, (size_t)h) * w;
+    for (size_t i = (size_t)chunk * rows * w; i < i1; ++i)
+      luma[i] = Utils::getLuminance(r[i], g[i], b[i]);
+  });
+
+  if (BlurPyramid::levelFor(radius, draft) == 0) {
+    float *const blurred = tmp.plane(0);
+    BlurPyramid::filter(luma, blurred, scratch.plane(1), w, h, radius, draft,
+                        sched);
+    Utils::parallelFor(sched, (y1 - y0 + rows - 1) / rows, [&](int chunk) {
+      const int ya = y0 + chunk * rows, yb = std::min(y1, ya + rows);
+      for (int y = ya; y < yb; ++y)
+        for (size_t i = (size_t)y * w + x0; i < (size_t)y * w + x1; ++i)
+          applyDreamyBlur(r[i], g[i], b[i], blurred[i], params);
+    });
+    return;
+  }
+
+  // Coarse luma (the upsample's guide) and its blur
+  BlurPyramid pyramid(scratch, 1, sched);
+  PlanarImage coarse;
+  const int k = pyramid.blurCoarse(radius, draft, coarse);
+  const int f = 1 << k;
+  const int cw = coarse.width(), ch = coarse.height();
+  const float *const guide = pyramid.level(k).plane(0);
+  const float *const blurred = coarse.plane(0);
+
+  // Coarse pixel j is centred on fine (j + 0.5) * f - 0.5; columns' taps
+  // and bilinear weights are tabled once
+  std::vector<int> cx0(x1 - x0), cx1(x1 - x0);
+  std::vector<float> tx(x1 - x0);
+  for (int x = x0; x < x1; ++x) {
+    const float fx = std::max(0.0f, ((float)x + 0.5f) / (float)f - 0.5f);
+    const int i = x - x0;
+    cx0[i] = std::min((int)fx, cw - 1);
+    cx1[i] = std::min(cx0[i] + 1, cw - 1);
+    tx[i] = fx - (float)cx0[i];
+  }
+  const float invRange = 1.0f / (kRangeSigma * kRangeSigma);
+  Utils::parallelFor(sched, (y1 - y0 + rows - 1) / rows, [&](int chunk) {
+    const int ya = y0 + chunk * rows, yb = std::min(y1, ya + rows);
+    std::vector<float> row(x1 - x0);
+    for (int y = ya; y < yb; ++y) {
+      const float fy = std::max(0.0f, ((float)y + 0.5f) / (float)f - 0.5f);
+      const int cy0 = std::min((int)fy, ch - 1);
+      const int cy1 = std::min(cy0 + 1, ch - 1);
+      const float ty = fy - (float)cy0;
+      const float *g0 = guide + (size_t)cy0 * cw;
+      const float *g1 = guide + (size_t)cy1 * cw;
+      const float *b0 = blurred + (size_t)cy0 * cw;
+      const float *b1 = blurred + (size_t)cy1 * cw;
+      const float *lrow = luma + (size_t)y * w + x0;
+      // Upsampled blurred luma for the row first, kept branch-free so it
+      // vectorises, then the blend
+      for (int i = 0; i < x1 - x0; ++i) {
+        const float L = lrow[i];
+        const int a = cx0[i], c = cx1[i];
+        // Bilinear weight over a Cauchy range weight, 1 / (1 + d^2 / s^2)
+        auto tap = [&](float bw, float gl) {
+          const float d =
+              (gl - L) / (std::abs(gl) + std::abs(L) + kRangeFloor);
+          return bw / (1.0f + d * d * invRange);
+        };
+        const float w00 = tap((1.0f - tx[i]) * (1.0f - ty), g0[a]);
+        const float w01 = tap(tx[i] * (1.0f - ty), g0[c]);
+        const float w10 = tap((1.0f - tx[i]) * ty, g1[a]);
+        const float w11 = tap(tx[i] * ty, g1[c]);
+        row[i] = (w00 * b0[a] + w01 * b0[c] + w10 * b1[a] + w11 * b1[c]) /
+                 (w00 + w01 + w10 + w11);
+      }
+      for (int x = x0; x < x1; ++x) {
+        const size_t p = (size_t)y * w + x;
+        applyDreamyBlur(r[p], g[p], b[p], row[x - x0], params);
+      }
+    }
+  });
+}
+
 } // namespace DreamyBlur
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "FastMath.h"
 #include "Utils.h"
 #include <algorithm>
 #include <cmath>
@@ -16,13 +17,13 @@ struct Params {
   double blurRadius; // Fixed small radius (scaled)
 };
 
-// Computes the source for the mist diffusion (isolated, tinted highlights)
-inline void computeMistSource(float r, float g, float b, float &outR,
-                              float &outG, float &outB, const Params &params) {
-  if (!params.enable) {
-    outR = outG = outB = 0.0f;
-    return;
-  }
+// Computes the source for the mist diffusion: the isolated highlight
+// energy. The warmth tint is constant, so it is applied after the blur and
+// only this one plane is blurred.
+inline float computeMistSource(float r, float g, float b,
+                               const Params &params) {
+  if (!params.enable)
+    return 0.0f;
 
   // 1. Luminance
   float L = Utils::getLuminance(r, g, b);
@@ -34,38 +35,31 @@ inline void computeMistSource(float r, float g, float b, float &outR,
 
   // 3. Depth Bias (Gamma)
   if (params.depthBias != 1.0 && mask > 0.0f) {
-    mask = std::pow(mask, (float)params.depthBias);
+    mask = FastMath::pow(mask, (float)params.depthBias);
   }
 
-  // 5. Color Bias (Warmth)
-  // -1 (Cool) to +1 (Warm)
-  float biasR = 1.0f;
-  float biasB = 1.0f;
+  // 4. Extract Source
+  // "Mist is mostly achromatic... Never oversaturate": luminance based, so
+  // it stays achromatic until the tint.
+  return L * mask;
+}
+
+// Color Bias (Warmth) of the mist layer, -1 (Cool) to +1 (Warm)
+inline void mistTint(const Params &params, float &tintR, float &tintB) {
+  tintR = 1.0f;
+  tintB = 1.0f;
   if (params.colorBias > 0) {
-    biasR += (float)params.colorBias * 0.5f;
-    biasB -= (float)params.colorBias * 0.2f;
+    tintR += (float)params.colorBias * 0.5f;
+    tintB -= (float)params.colorBias * 0.2f;
   } else if (params.colorBias < 0) {
-    biasB += std::abs((float)params.colorBias) * 0.5f;
-    biasR -= std::abs((float)params.colorBias) * 0.2f;
+    tintB += std::abs((float)params.colorBias) * 0.5f;
+    tintR -= std::abs((float)params.colorBias) * 0.2f;
   }
-
-  // 6. Extract Source
-  // Mist is "mostly achromatic".
-  // We can use L * mask * colorBias, or Input * mask * colorBias.
-  // "Mist behaves like light scattering... affects only the highest-energy
-  // light". "Mist is mostly achromatic... Never oversaturate". Let's use
-  // Luminance based source to keep it achromatic, then apply tint. Or
-  // desaturated Input? Let's use L * mask.
-  float mistL = L * mask;
-
-  outR = mistL * biasR;
-  outG = mistL; // Green is anchor
-  outB = mistL * biasB;
 }
 
-// Applies the diffused mist to the image
-inline void applyMist(float &r, float &g, float &b, float mistR, float mistG,
-                      float mistB, const Params &params) {
+// Applies the diffused mist (blurred source) to the image
+inline void applyMist(float &r, float &g, float &b, float mist,
+                      const Params &params) {
   if (!params.enable)
     return;
 
@@ -73,15 +67,15 @@ inline void applyMist(float &r, float &g, float &b, float mistR, float mistG,
   // Which is: output = input + mistLayer * mistStrength
   // "Energy Conserving Veil Model: Mist must reduce local contrast WITHOUT
   // reducing exposure." "The image must never get darker."
-
-  float s = (float)params.strength;
-
-  r = r + mistR * s;
-  g = g + mistG * s;
-  b = b + mistB * s;
+  float tintR, tintB;
+  mistTint(params, tintR, tintB);
+  float s = (float)params.strength * mist;
+  r = r + tintR * s;
+  g = g + s; // Green is anchor
+  b = b + tintB * s;
 
   // Note: This purely adds light (lifts). This reduces contrast by lifting
-  // shadows/mids relative to highlights? Wait, mistR/G/B comes from highlights.
+  // shadows/mids relative to highlights? Wait, the mist comes from highlights.
   // So we are adding highlights to the image. If we add blurred highlights to
   // the image, we get a glow/mist effect. This lifts the area AROUND the
   // highlights (because it's blurred). This matches "Lifts perceived air...
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Polynomial approximations of the transcendentals used per pixel.
+ *
+ * FastMath::Approx holds the approximations. They are branch-light and
+ * only use float arithmetic and integer bit casts, so loops over them
+ * vectorise (the *N array forms are such loops). FastMath::log2/exp2/pow/
+ * tanh/rsqrt are what the modules call: exact std:: functions by default,
+ * the approximations when built with -DCIE_FAST_MATH=ON.
+ *
+ * Maximum errors against double precision, checked by tests/FastMathTest
+ * over the float bit patterns of each domain:
+ *   log2   absolute 1.2e-7 + 1 ulp of the result   x in [FLT_MIN, FLT_MAX]
+ *   exp2   relative 2.5e-7                         x in [-126, 127]
+ *   pow    relative 4e-7 + 1e-7 * |y * log2 x|     x > 0, result in
+ *                                                  [2^-126, 2^127];
+ *                                                  0 for x <= 0
+ *   tanh   relative 4.2e-7, absolute 2.1e-7        all x (denormals
+ *                                                  flush to 0 under
+ *                                                  -ffast-math)
+ *   rsqrt  relative 4.8e-6                         x in [2^-125, 2^125]
+ *                                                  (outside, x / 2 or
+ *                                                  y * y is denormal and
+ *                                                  flushes to 0 under
+ *                                                  -ffast-math)
+ * All well under what a half-float output can resolve (4.9e-4).
+ */
+namespace FastMath {
+
+namespace Approx {
+
+inline uint32_t bits(float x) {
+  uint32_t u;
+  std::memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+inline float fromBits(uint32_t u) {
+  float x;
+  std::memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+// log2 for x > 0 (normal). Splits off the exponent and evaluates the
+// atanh series in t = (m - 1) / (m + 1), m in [sqrt(1/2), sqrt(2)).
+inline float log2(float x) {
+  uint32_t u = bits(x);
+  // Re-centre the mantissa on 1 so the polynomial stays near zero
+  const uint32_t off = u - 0x3f3504f3u; // sqrt(1/2)
+  const int e = (int)off >> 23;
+  const float m = fromBits(u - ((uint32_t)e << 23));
+  const float t = (m - 1.0f) / (m + 1.0f);
+  const float t2 = t * t;
+  // 2/ln2 * atanh(t) series, odd terms to t^9
+  const float p =
+      t * (2.88539008f +
+           t2 * (0.961796694f +
+                 t2 * (0.577078016f + t2 * (0.412198583f + t2 * 0.320598898f))));
+  return (float)e + p;
+}
+
+// exp2, clamped to the normal float range
+inline float exp2(float x) {
+  x = x < -126.0f ? -126.0f : (x > 127.499f ? 127.499f : x);
+  const float fi = std::floor(x + 0.5f);
+  const float f = x - fi; // [-0.5, 0.5]
+  // Taylor series of 2^f = e^(f ln2) to f^6
+  const float p =
+      1.0f +
+      f * (0.693147181f +
+           f * (0.240226507f +
+                f * (0.0555041087f +
+                     f * (0.00961812911f +
+                          f * (0.00133335581f + f * 0.000154035304f)))));
+  return fromBits(bits(p) + ((uint32_t)(int)fi << 23));
+}
+
+// x^y for x > 0; 0 for x <= 0, which is what every caller clamps to.
+inline float pow(float x, float y) {
+  return x > 0.0f ? exp2(y * log2(x)) : 0.0f;
+}
+
+// tanh: odd Taylor polynomial near zero (no cancellation), exp2 form
+// beyond, saturated past |x| = 9.
+inline float tanh(float x) {
+  const float a = std::fabs(x);
+  float r;
+  if (a < 0.55f) {
+    const float x2 = a * a;
+    r = a * (1.0f +
+             x2 * (-0.333333333f +
+                   x2 * (0.133333333f +
+                         x2 * (-0.0539682540f +
+                               x2 * (0.0218694885f +
+                                     x2 * (-0.00886323552f +
+                                           x2 * 0.00359212803f))))));
+  } else if (a < 9.0f) {
+    const float e = exp2(a * 2.88539008f); // e^(2a)
+    r = 1.0f - 2.0f / (e + 1.0f);
+  } else {
+    r = 1.0f;
+  }
+  return x < 0.0f ? -r : r;
+}
+
+// 1/sqrt(x) for x > 0: bit-level estimate and two Newton steps
+inline float rsqrt(float x) {
+  float y = fromBits(0x5f375a86u - (bits(x) >> 1));
+  const float h = 0.5f * x;
+  y = y * (1.5f - h * y * y);
+  y = y * (1.5f - h * y * y);
+  return y;
+}
+
+// Array forms — plain loops the compiler turns into SIMD
+inline void log2N(const float *in, float *out, int n) {
+  for (int i = 0; i < n; ++i)
+    out[i] = log2(in[i]);
+}
+
+inline void exp2N(const float *in, float *out, int n) {
+  for (int i = 0; i < n; ++i)
+    out[i] = exp2(in[i]);
+}
+
+inline void powN(const float *in, float y, float *out, int n) {
+  for (int i = 0; i < n; ++i)
+    out[i] = pow(in[i], y);
+}
+
+inline void tanhN(const float *in, float *out, int n) {
+  for (int i = 0; i < n; ++i)
+    out[i] = tanh(in[i]);
+}
+
+inline void rsqrtN(const float *in, float *out, int n) {
+  for (int i = 0; i < n; ++i)
+    out[i] = rsqrt(in[i]);
+}
+
+} // namespace Approx
+
+// Build-selected versions (CIE_FAST_MATH)
+#if defined(CIE_FAST_MATH) && CIE_FAST_MATH
+inline float log2(float x) { return Approx::log2(x); }
+inline float exp2(float x) { return Approx::exp2(x); }
+inline float pow(float x, float y) { return Approx::pow(x, y); }
+inline float tanh(float x) { return Approx::tanh(x); }
+inline float rsqrt(float x) { return Approx::rsqrt(x); }
+#else
+inline float log2(float x) { return std::log2(x); }
+inline float exp2(float x) { return std::exp2(x); }
+inline float pow(float x, float y) { return std::pow(x, y); }
+inline float tanh(float x) { return std::tanh(x); }
+inline float rsqrt(float x) { return 1.0f / std::sqrt(x); }
+#endif
+
+} // namespace FastMath
@@ -17,6 +17,11 @@ public:
     GT_CLEAN
   };
 
+  // Classic: one hashed value per cell, nearest sampled (hard-edged cells).
+  // Organic: cell noise summed over three octaves of blur at the cell grid,
+  //          then bicubically upsampled — soft, clumped grain.
+  enum GrainModel { GM_CLASSIC = 0, GM_ORGANIC };
+
   struct Params {
     bool enable;
     float amount; // Master strength
@@ -27,6 +32,7 @@ public:
     int grainType;       // Dropdown enum
     bool chromatic;      // Per-channel independent grain
     float temporalSpeed; // 0 = static, 1 = 24fps variation
+    int model;           // GrainModel
   };
 
   // 1. FAST INTEGER HASH
@@ -42,70 +48,101 @@ public:
     return (n1 + n2 - 1.0f);
   }
 
-  static void applyGrain(float *r, float *g, float *b, int x, int y,
-                         int frameSeed, int imageW, int imageH,
-                         const Params &p) {
-    if (!p.enable || p.amount <= 0.0f)
-      return;
-
-    // 3. GRAIN SPACE
+  // 3. GRAIN SPACE — pixels per grain cell
+  static inline float cellScale(int imageW, int imageH, const Params &p) {
     float minDim = (float)std::min(imageW, imageH);
     float rawSize = std::max(0.001f, p.size);
     float scale = (0.0015f + rawSize * 0.005f) * minDim;
-    if (scale < 1.0f)
-      scale = 1.0f;
-
-    int gx = int(x / scale);
-    int gy = int(y / scale);
+    return scale < 1.0f ? 1.0f : scale;
+  }
 
-    // 4. TEMPORAL — scale frame seed by temporal speed
-    // 0 = static grain (same every frame), 1 = full 24fps variation
-    int effectiveSeed = frameSeed;
+  // 4. TEMPORAL — scale frame seed by temporal speed
+  // 0 = static grain (same every frame), 1 = full 24fps variation
+  static inline int effectiveSeed(int frameSeed, const Params &p) {
     if (p.temporalSpeed < 1.0f) {
       // Quantize seed to reduce temporal variation
       float interval = std::max(1.0f, 24.0f * (1.0f - p.temporalSpeed));
-      effectiveSeed = (int)(frameSeed / interval) * (int)interval;
+      return (int)(frameSeed / interval) * (int)interval;
     }
+    return frameSeed;
+  }
 
-    // 5. GRAIN GEN
-    if (p.chromatic) {
+  // 5. GRAIN GEN — noise for one grain cell. Mono grain fills n[0] only.
+  static inline void sampleCell(int gx, int gy, int seed, bool chromatic,
+                                float n[3]) {
+    if (chromatic) {
       // Per-channel independent grain with offset seeds
-      float n1R = hash2D(gx, gy, effectiveSeed);
-      float n2R = hash2D(gx + 17, gy + 29, effectiveSeed);
-      float n1G = hash2D(gx, gy, effectiveSeed + 7);
-      float n2G = hash2D(gx + 17, gy + 29, effectiveSeed + 7);
-      float n1B = hash2D(gx, gy, effectiveSeed + 13);
-      float n2B = hash2D(gx + 17, gy + 29, effectiveSeed + 13);
-
-      float grainR = gaussianApprox(n1R, n2R);
-      float grainG = gaussianApprox(n1G, n2G);
-      float grainB = gaussianApprox(n1B, n2B);
-
-      // 6. LUM WEIGHTING
-      float L = 0.2126f * (*r) + 0.7152f * (*g) + 0.0722f * (*b);
-      float finalWeight = computeWeight(L, p);
-      float strength = p.amount * finalWeight;
-
-      *r *= (1.0f + grainR * strength);
-      *g *= (1.0f + grainG * strength);
-      *b *= (1.0f + grainB * strength);
+      n[0] = gaussianApprox(hash2D(gx, gy, seed),
+                            hash2D(gx + 17, gy + 29, seed));
+      n[1] = gaussianApprox(hash2D(gx, gy, seed + 7),
+                            hash2D(gx + 17, gy + 29, seed + 7));
+      n[2] = gaussianApprox(hash2D(gx, gy, seed + 13),
+                            hash2D(gx + 17, gy + 29, seed + 13));
     } else {
-      // Monochromatic grain (original behavior)
-      float n1 = hash2D(gx, gy, effectiveSeed);
-      float n2 = hash2D(gx + 17, gy + 29, effectiveSeed);
-      float grain = gaussianApprox(n1, n2);
+      n[0] = gaussianApprox(hash2D(gx, gy, seed),
+                            hash2D(gx + 17, gy + 29, seed));
+    }
+  }
 
-      float L = 0.2126f * (*r) + 0.7152f * (*g) + 0.0722f * (*b);
-      float finalWeight = computeWeight(L, p);
-      float strength = p.amount * finalWeight;
+  // 6. LUM WEIGHTING + multiplicative blend of a pre-sampled cell
+  static inline void applyNoise(float *r, float *g, float *b, const float n[3],
+                                const Params &p) {
+    float L = 0.2126f * (*r) + 0.7152f * (*g) + 0.0722f * (*b);
+    float strength = p.amount * computeWeight(L, p);
 
-      float grainSignal = 1.0f + grain * strength;
+    if (p.chromatic) {
+      *r *= (1.0f + n[0] * strength);
+      *g *= (1.0f + n[1] * strength);
+      *b *= (1.0f + n[2] * strength);
+    } else {
+      float grainSignal = 1.0f + n[0] * strength;
       *r *= grainSignal;
       *g *= grainSignal;
       *b *= grainSignal;
     }
   }
 
+  static void applyGrain(float *r, float *g, float *b, int x, int y,
+                         int frameSeed, int imageW, int imageH,
+                         const Params &p) {
+    if (!p.enable || p.amount <= 0.0f)
+      return;
+
+    float scale = cellScale(imageW, imageH, p);
+    float n[3];
+    sampleCell(int(x / scale), int(y / scale), effectiveSeed(frameSeed, p),
+               p.chromatic, n);
+    applyNoise(r, g, b, n, p);
+  }
+
+  // 7. ORGANIC OCTAVE WEIGHTS — fine / medium / coarse clump mix per stock.
+  // Smaller gauges clump more; larger formats stay close to white noise.
+  static inline void octaveWeights(int grainType, float w[3]) {
+    static const float kWeights[7][3] = {
+        {0.50f, 0.35f, 0.15f}, // Custom
+        {0.20f, 0.40f, 0.40f}, // 8mm
+        {0.30f, 0.40f, 0.30f}, // 16mm
+        {0.40f, 0.40f, 0.20f}, // Super 16
+        {0.55f, 0.35f, 0.10f}, // 35mm
+        {0.70f, 0.25f, 0.05f}, // 65mm
+        {0.85f, 0.15f, 0.00f}, // Clean
+    };
+    const int t = (grainType >= 0 && grainType < 7) ? grainType : 0;
+    w[0] = kWeights[t][0];
+    w[1] = kWeights[t][1];
+    w[2] = kWeights[t][2];
+  }
+
+  // 8. CATMULL-ROM weights for taps at -1, 0, 1, 2 around fraction t
+  static inline void cubicWeights(float t, float w[4]) {
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    w[0] = 0.5f * (-t3 + 2.0f * t2 - t);
+    w[1] = 0.5f * (3.0f * t3 - 5.0f * t2 + 2.0f);
+    w[2] = 0.5f * (-3.0f * t3 + 4.0f * t2 + t);
+    w[3] = 0.5f * (t3 - t2);
+  }
+
 private:
   static inline float computeWeight(float L, const Params &p) {
     if (L < 0.5f) {
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief In-process LRU cache of rendered frames.
+ *
+ * Hosts re-request identical frames constantly (scrubbing back and forth,
+ * viewer refreshes, UI changes that don't touch the image). Entries are
+ * keyed by a hash of every parameter value, the time, the render window and
+ * scale, and a hash of every source pixel in the window. A hit hands back the
+ * stored RGBA window so the caller can copy it out row by row.
+ *
+ * Thread-safe; entries are shared_ptr so an eviction never invalidates a
+ * copy in progress.
+ */
+class FrameCache {
+public:
+  struct Key {
+    uint64_t paramHash;
+    uint64_t sourceHash;
+    double time;
+    int x1, y1, x2, y2; // render window
+    double scaleX, scaleY;
+
+    bool operator==(const Key &o) const {
+      return paramHash == o.paramHash && sourceHash == o.sourceHash &&
+             time == o.time && x1 == o.x1 && y1 == o.y1 && x2 == o.x2 &&
+             y2 == o.y2 && scaleX == o.scaleX && scaleY == o.scaleY;
+    }
+  };
+
+  struct Entry {
+    int width;
+    int height;
+    std::vector<float> pixels; // width * height RGBA, tightly packed
+  };
+
+  // FNV-1a, 64-bit. Chain calls through `seed` to hash several blocks.
+  static uint64_t hashBytes(const void *data, size_t size,
+                            uint64_t seed = 0xcbf29ce484222325ull) {
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    uint64_t h = seed;
+    for (size_t i = 0; i < size; ++i) {
+      h ^= p[i];
+      h *= 0x100000001b3ull;
+    }
+    return h;
+  }
+
+  template <class T> static uint64_t hashValue(const T &v, uint64_t seed) {
+    return hashBytes(&v, sizeof(T), seed);
+  }
+
+  // Bulk data (whole source images): four independent multiply-xorshift
+  // lanes over 8-byte words, the tail through hashBytes. Runs at memory
+  // bandwidth where hashBytes manages about a byte per cycle.
+  static uint64_t hashWords(const void *data, size_t size, uint64_t seed) {
+    static constexpr uint64_t kMul = 0x9e3779b97f4a7c15ull;
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    uint64_t lane[4] = {seed, seed ^ 0x243f6a8885a308d3ull,
+                        seed ^ 0x13198a2e03707344ull,
+                        seed ^ 0xa4093822299f31d0ull};
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+      for (int k = 0; k < 4; ++k) {
+        uint64_t w;
+        std::memcpy(&w, p + i + 8 * k, 8);
+        lane[k] = (lane[k] ^ w) * kMul;
+        lane[k] ^= lane[k] >> 29;
+      }
+    }
+    uint64_t h = hashBytes(lane, sizeof(lane), seed);
+    return hashBytes(p + i, size - i, h);
+  }
+
+  explicit FrameCache(size_t budgetBytes = 0)
+      : _budget(budgetBytes), _used(0), _hits(0), _misses(0) {}
+
+  // Change the memory budget; evicts down to it immediately. 0 disables.
+  void setBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _budget = bytes;
+    evictLocked(0);
+  }
+
+  size_t budget() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _budget;
+  }
+
+  // Returns the cached frame or null. Counts a hit or a miss.
+  std::shared_ptr<const Entry> find(const Key &key) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(digest(key));
+    if (it == _index.end() || !(it->second->key == key)) {
+      ++_misses;
+      return nullptr;
+    }
+    // Move to most-recently-used
+    _lru.splice(_lru.begin(), _lru, it->second);
+    ++_hits;
+    return it->second->entry;
+  }
+
+  // Stores a rendered frame, evicting least-recently-used entries to fit.
+  // Frames larger than the whole budget are not cached.
+  void insert(const Key &key, std::shared_ptr<const Entry> entry) {
+    const size_t bytes = entry->pixels.size() * sizeof(float);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (bytes > _budget)
+      return;
+
+    const uint64_t d = digest(key);
+    auto it = _index.find(d);
+    if (it != _index.end()) {
+      _used -= it->second->bytes;
+      _lru.erase(it->second);
+      _index.erase(it);
+    }
+
+    evictLocked(bytes);
+    _lru.push_front(Slot{key, std::move(entry), bytes});
+    _index[d] = _lru.begin();
+    _used += bytes;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _lru.clear();
+    _index.clear();
+    _used = 0;
+  }
+
+  uint64_t hits() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hits;
+  }
+  uint64_t misses() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _misses;
+  }
+  size_t bytesUsed() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _used;
+  }
+
+private:
+  struct Slot {
+    Key key;
+    std::shared_ptr<const Entry> entry;
+    size_t bytes;
+  };
+
+  static uint64_t digest(const Key &k) {
+    uint64_t h = hashValue(k.paramHash, 0xcbf29ce484222325ull);
+    h = hashValue(k.sourceHash, h);
+    h = hashValue(k.time, h);
+    const int win[4] = {k.x1, k.y1, k.x2, k.y2};
+    h = hashBytes(win, sizeof(win), h);
+    h = hashValue(k.scaleX, h);
+    return hashValue(k.scaleY, h);
+  }
+
+  // Evict LRU entries until `incoming` more bytes fit in the budget
+  void evictLocked(size_t incoming) {
+    while (!_lru.empty() && _used + incoming > _budget) {
+      const Slot &victim = _lru.back();
+      _used -= victim.bytes;
+      _index.erase(digest(victim.key));
+      _lru.pop_back();
+    }
+  }
+
+  mutable std::mutex _mutex;
+  std::list<Slot> _lru; // front = most recently used
+  std::unordered_map<uint64_t, std::list<Slot>::iterator> _index;
+  size_t _budget;
+  size_t _used;
+  uint64_t _hits;
+  uint64_t _misses;
+};
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "FilmGrain.h"
+
+/**
+ * @brief Cache of pre-generated grain cell fields.
+ *
+ * Grain noise depends only on the effective seed, the mono/chromatic switch,
+ * the grain model (and for Organic the stock) and the cell index, so a frame
+ * whose quantised seed repeats (static or slow temporal grain, scrubbing
+ * back and forth) sees exactly the same field. acquire() returns the noise
+ * of every cell covering a range once, generating it on a miss; Stage 0
+ * then reads one float (or three) per pixel instead of hashing.
+ *
+ * Classic values are bit-identical to FilmGrain::sampleCell; cells outside
+ * the field (deep apron) fall back to sampling directly. Organic fields are
+ * the octave mix at the cell grid, upsampled by the caller.
+ *
+ * Thread-safe; fields are shared_ptr so eviction never pulls one out from
+ * under a frame still rendering.
+ */
+class GrainField {
+public:
+  struct Field {
+    int seed;
+    bool chromatic;
+    int model;     // FilmGrain::GrainModel
+    int grainType; // octave weights (Organic only)
+    int x0, y0, x1, y1; // cell range, half-open
+    int channels;       // 1 mono, 3 chromatic
+    std::vector<float> noise;
+
+    // Noise of cell (x0, cy), or null when cy is outside the field
+    const float *row(int cy) const {
+      if (cy < y0 || cy >= y1)
+        return nullptr;
+      return noise.data() + (size_t)(cy - y0) * (x1 - x0) * channels;
+    }
+  };
+
+  // Larger fields are not cached (a very fine grain on a very large
+  // frame); 2M cells is 24 MB chromatic.
+  static const size_t kMaxCells = 2u << 20;
+  static const size_t kMaxFields = 4;
+
+  GrainField() : _hits(0), _misses(0) {}
+
+  GrainField(const GrainField &) = delete;
+  GrainField &operator=(const GrainField &) = delete;
+
+  // Returns the field for the cell range, or null when it is too large
+  std::shared_ptr<const Field> acquire(int seed, bool chromatic, int model,
+                                       int grainType, int x0, int y0, int x1,
+                                       int y1) {
+    if (x1 <= x0 || y1 <= y0 ||
+        (size_t)(x1 - x0) * (size_t)(y1 - y0) > kMaxCells)
+      return nullptr;
+    if (model != FilmGrain::GM_ORGANIC)
+      grainType = 0; // Classic noise does not depend on the stock
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (auto it = _fields.begin(); it != _fields.end(); ++it) {
+        const Field &f = **it;
+        if (f.seed == seed && f.chromatic == chromatic && f.model == model &&
+            f.grainType == grainType && f.x0 == x0 &&
+            f.y0 == y0 && f.x1 == x1 && f.y1 == y1) {
+          _fields.splice(_fields.begin(), _fields, it);
+          ++_hits;
+          return _fields.front();
+        }
+      }
+      ++_misses;
+    }
+
+    // Generate outside the lock; a racing duplicate is harmless
+    std::shared_ptr<Field> f = std::make_shared<Field>();
+    f->seed = seed;
+    f->chromatic = chromatic;
+    f->model = model;
+    f->grainType = grainType;
+    f->x0 = x0;
+    f->y0 = y0;
+    f->x1 = x1;
+    f->y1 = y1;
+    f->channels = chromatic ? 3 : 1;
+    if (model == FilmGrain::GM_ORGANIC)
+      generateOrganic(*f);
+    else
+      generate(*f);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _fields.push_front(f);
+    if (_fields.size() > kMaxFields)
+      _fields.pop_back();
+    return f;
+  }
+
+  uint64_t hits() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hits;
+  }
+  uint64_t misses() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _misses;
+  }
+
+  // Fill n cells of one channel, cells (cx0 .. cx0+n-1, cy), interleaved
+  // with stride `stride`. Same arithmetic as FilmGrain::sampleCell, laid
+  // out in fixed blocks of lanes so the integer hash vectorises (8 x 32-bit
+  // per AVX2 register).
+  static void fillRow(float *out, int stride, int cx0, int cy, int n,
+                      int seed) {
+    const int kLanes = 8;
+    const uint32_t s = uint32_t(seed);
+    const uint32_t ya = uint32_t(cy) * 668265263u;
+    const uint32_t yb = uint32_t(cy + 29) * 668265263u;
+
+    int i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+      float v[kLanes];
+      for (int l = 0; l < kLanes; ++l) {
+        const uint32_t x = uint32_t(cx0 + i + l);
+        uint32_t a = x * 374761393u + ya;
+        uint32_t b = (x + 17u) * 374761393u + yb;
+        a = ((a ^ (a >> 13)) ^ s) * 1274126177u;
+        b = ((b ^ (b >> 13)) ^ s) * 1274126177u;
+        v[l] = FilmGrain::gaussianApprox(
+            (a & 0x00FFFFFF) / float(0x01000000),
+            (b & 0x00FFFFFF) / float(0x01000000));
+      }
+      for (int l = 0; l < kLanes; ++l)
+        out[(size_t)(i + l) * stride] = v[l];
+    }
+    for (; i < n; ++i) {
+      const int x = cx0 + i;
+      out[(size_t)i * stride] = FilmGrain::gaussianApprox(
+          FilmGrain::hash2D(x, cy, seed),
+          FilmGrain::hash2D(x + 17, cy + 29, seed));
+    }
+  }
+
+private:
+  static void generate(Field &f) {
+    const int w = f.x1 - f.x0;
+    f.noise.resize((size_t)w * (f.y1 - f.y0) * f.channels);
+    for (int cy = f.y0; cy < f.y1; ++cy) {
+      float *row = f.noise.data() + (size_t)(cy - f.y0) * w * f.channels;
+      for (int c = 0; c < f.channels; ++c)
+        fillRow(row + c, f.channels, f.x0, cy, w, f.seed + seedOffset(c));
+    }
+  }
+
+  // Channel seed offsets match FilmGrain::sampleCell
+  static int seedOffset(int c) { return c == 0 ? 0 : (c == 1 ? 7 : 13); }
+
+  // 5-tap binomial [1 4 6 4 1] / 16, separable, taps `step` cells apart,
+  // edges clamped.
+  static void binomial5(const float *src, float *dst, float *tmp, int w,
+                        int h, int step) {
+    static const float k[5] = {1.0f / 16, 4.0f / 16, 6.0f / 16, 4.0f / 16,
+                               1.0f / 16};
+    for (int y = 0; y < h; ++y) {
+      const float *s = src + (size_t)y * w;
+      float *t = tmp + (size_t)y * w;
+      for (int x = 0; x < w; ++x) {
+        float acc = 0.0f;
+        for (int i = -2; i <= 2; ++i) {
+          const int xx = std::min(std::max(x + i * step, 0), w - 1);
+          acc += k[i + 2] * s[xx];
+        }
+        t[x] = acc;
+      }
+    }
+    for (int y = 0; y < h; ++y) {
+      float *d = dst + (size_t)y * w;
+      for (int x = 0; x < w; ++x)
+        d[x] = 0.0f;
+      for (int i = -2; i <= 2; ++i) {
+        const int yy = std::min(std::max(y + i * step, 0), h - 1);
+        const float *t = tmp + (size_t)yy * w;
+        for (int x = 0; x < w; ++x)
+          d[x] += k[i + 2] * t[x];
+      }
+    }
+  }
+
+  // Organic: white cell noise plus two blurred octaves (binomial, then the
+  // same kernel dilated by 2), each rescaled back to the white noise's
+  // spread before mixing with the stock's octave weights.
+  static void generateOrganic(Field &f) {
+    const int kPad = 6; // support of both passes: 2 + 4 cells
+    const int w = f.x1 - f.x0;
+    const int h = f.y1 - f.y0;
+    const int pw = w + 2 * kPad;
+    const int ph = h + 2 * kPad;
+
+    // 1D kernels of each octave, centred in 13 taps. An octave's standard
+    // deviation gain for white noise is the squared norm of its 1D kernel.
+    double k[3][13] = {{0}};
+    double e[3] = {0.0, 0.0, 0.0};
+    static const double kBinomial[5] = {1 / 16.0, 4 / 16.0, 6 / 16.0,
+                                        4 / 16.0, 1 / 16.0};
+    k[0][6] = 1.0;
+    for (int i = 0; i < 5; ++i) {
+      k[1][4 + i] = kBinomial[i];
+      for (int j = 0; j < 5; ++j)
+        k[2][i + 2 * j] += kBinomial[i] * kBinomial[j];
+    }
+    for (int o = 0; o < 3; ++o)
+      for (int i = 0; i < 13; ++i)
+        e[o] += k[o][i] * k[o][i];
+
+    // Octaves share their source, so normalise the mix by the energy of the
+    // combined 2D kernel to keep the white noise's spread.
+    float ow[3];
+    FilmGrain::octaveWeights(f.grainType, ow);
+    double gain[3], energy = 0.0;
+    for (int o = 0; o < 3; ++o)
+      gain[o] = ow[o] / e[o];
+    for (int y = 0; y < 13; ++y)
+      for (int x = 0; x < 13; ++x) {
+        double m = 0.0;
+        for (int o = 0; o < 3; ++o)
+          m += gain[o] * k[o][y] * k[o][x];
+        energy += m * m;
+      }
+    const double norm = 1.0 / std::sqrt(energy);
+    const float g0 = (float)(gain[0] * norm);
+    const float g1 = (float)(gain[1] * norm);
+    const float g2 = (float)(gain[2] * norm);
+
+    std::vector<float> white((size_t)pw * ph), o1(white.size()),
+        o2(white.size()), tmp(white.size());
+    f.noise.resize((size_t)w * h * f.channels);
+
+    for (int c = 0; c < f.channels; ++c) {
+      for (int y = 0; y < ph; ++y)
+        fillRow(&white[(size_t)y * pw], 1, f.x0 - kPad, f.y0 - kPad + y, pw,
+                f.seed + seedOffset(c));
+      binomial5(white.data(), o1.data(), tmp.data(), pw, ph, 1);
+      binomial5(o1.data(), o2.data(), tmp.data(), pw, ph, 2);
+
+      for (int y = 0; y < h; ++y) {
+        const size_t src = (size_t)(y + kPad) * pw + kPad;
+        float *out = f.noise.data() + (size_t)y * w * f.channels + c;
+        for (int x = 0; x < w; ++x)
+          out[(size_t)x * f.channels] = g0 * white[src + x] +
+                                        g1 * o1[src + x] + g2 * o2[src + x];
+      }
+    }
+  }
+
+  mutable std::mutex _mutex;
+  std::list<std::shared_ptr<const Field>> _fields; // front = most recent
+  uint64_t _hits;
+  uint64_t _misses;
+};
@@ -1,11 +1,14 @@
 #pragma once
 
+#include "BlurPyramid.h"
 #include "Utils.h"
 #include <algorithm>
 #include <cmath>
 
 namespace Halation {
 
+enum Mode { eUniform = 0, eSpectral = 1 };
+
 struct Params {
   bool enable;
   double amount;
@@ -14,17 +17,27 @@ struct Params {
   double warmth;     // 0 (pure red) to 1 (orange/amber)
   double radius;     // Spatial radius
   double saturation; // Halation color saturation (0=mono, 1=full color)
+  int mode;          // Mode: one radius, or one per channel
+  double spread[3];  // Spectral: R, G, B radius as a multiple of radius
 };
 
-// Compute the source color that will be blurred to create the halation effect.
-// Uses luminance as energy source (not just red channel) so the effect is
-// visible on all footage, not just red-dominant scenes.
-inline void computeHalationSource(float r, float g, float b, float &hR,
-                                  float &hG, float &hB, const Params &params) {
-  if (!params.enable || params.amount <= 0.0) {
-    hR = hG = hB = 0.0f;
-    return;
-  }
+// Multiple of radius the widest channel scatters to
+inline double maxSpread(const Params &params) {
+  if (params.mode != eSpectral)
+    return 1.0;
+  return std::max(0.0, std::max(params.spread[0],
+                                std::max(params.spread[1], params.spread[2])));
+}
+
+// Compute the highlight energy that is blurred to create the halation
+// effect. Uses luminance as energy source (not just red channel) so the
+// effect is visible on all footage, not just red-dominant scenes. The
+// scatter tint is constant, so it is applied after the blur and only this
+// one plane is blurred.
+inline float computeHalationSource(float r, float g, float b,
+                                   const Params &params) {
+  if (!params.enable || params.amount <= 0.0)
+    return 0.0f;
 
   float L = Utils::getLuminance(r, g, b);
 
@@ -32,49 +45,82 @@ inline void computeHalationSource(float r, float g, float b, float &hR,
   float mask = Utils::smoothstep(
       (float)params.threshold, (float)params.threshold + (float)params.knee, L);
 
-  if (mask <= 0.001f) {
-    hR = hG = hB = 0.0f;
-    return;
-  }
+  if (mask <= 0.001f)
+    return 0.0f;
 
   // Energy: luminance-weighted (visible on ALL footage, not just red scenes)
-  float energy = L * mask;
+  return L * mask;
+}
 
-  // Scatter color: warm red-orange tint (film halation physics)
-  // warmth=0 → pure red (1.0, 0.1, 0.0)
-  // warmth=1 → amber/orange (1.0, 0.5, 0.05)
+// Scatter color: warm red-orange tint (film halation physics), with the
+// Saturation control folded in (1.0 = full color, 0.0 = luminance only)
+// warmth=0 → pure red (1.0, 0.1, 0.0)
+// warmth=1 → amber/orange (1.0, 0.5, 0.05)
+inline void halationTint(const Params &params, float &tintR, float &tintG,
+                         float &tintB) {
   float warmth = std::max(0.0f, std::min(1.0f, (float)params.warmth));
-  float tintR = 1.0f;
-  float tintG = 0.1f + warmth * 0.4f;
-  float tintB = warmth * 0.05f;
+  tintR = 1.0f;
+  tintG = 0.1f + warmth * 0.4f;
+  tintB = warmth * 0.05f;
 
-  hR = energy * tintR;
-  hG = energy * tintG;
-  hB = energy * tintB;
+  float sat = std::max(0.0f, std::min(1.0f, (float)params.saturation));
+  if (sat < 1.0f) {
+    float tL = Utils::getLuminance(tintR, tintG, tintB);
+    tintR = Utils::mix(tL, tintR, sat);
+    tintG = Utils::mix(tL, tintG, sat);
+    tintB = Utils::mix(tL, tintB, sat);
+  }
 }
 
-// Apply the blurred halation to the original pixel.
-inline void applyHalation(float *r, float *g, float *b, float hBlurR,
-                          float hBlurG, float hBlurB, const Params &params) {
+// Apply the blurred halation energy to the original pixel; Spectral passes
+// the energy blurred at each channel's radius.
+inline void applyHalation(float *r, float *g, float *b, float energyR,
+                          float energyG, float energyB, const Params &params) {
   if (!params.enable || params.amount <= 0.0)
     return;
 
-  float amt = (float)params.amount;
-
-  // Saturation control: desaturate the halation contribution
-  // before blending. 1.0 = full color, 0.0 = luminance only.
-  float sat = std::max(0.0f, std::min(1.0f, (float)params.saturation));
-  if (sat < 1.0f) {
-    float hL = Utils::getLuminance(hBlurR, hBlurG, hBlurB);
-    hBlurR = Utils::mix(hL, hBlurR, sat);
-    hBlurG = Utils::mix(hL, hBlurG, sat);
-    hBlurB = Utils::mix(hL, hBlurB, sat);
-  }
+  float tintR, tintG, tintB;
+  halationTint(params, tintR, tintG, tintB);
 
   // Additive blend (HDR safe — no clamping)
-  *r += hBlurR * amt;
-  *g += hBlurG * amt;
-  *b += hBlurB * amt;
+  float amount = (float)params.amount;
+  *r += tintR * energyR * amount;
+  *g += tintG * energyG * amount;
+  *b += tintB * energyB * amount;
+}
+
+inline void applyHalation(float *r, float *g, float *b, float energy,
+                          const Params &params) {
+  applyHalation(r, g, b, energy, energy, energy, params);
+}
+
+// Spectral scatter: the energy in plane 0 of layer is blurred at each
+// channel's radius into planes 0-2. All three read one BlurPyramid of the
+// energy, each from its own level (red, the widest, from the coarsest).
+// Scatter is smooth, so a channel that would blur at full size (blue,
+// usually) runs at level 1 instead wherever its residual blur keeps half
+// of kMinResidual; the three then cost about one blur at the base radius.
+// Plane 0 is written last, once no level is still to be built from it.
+// tmp is scratch of layer's size.
+template <class T>
+inline void spectralBlur(PlanarImageT<T> &layer, PlanarImageT<T> &tmp,
+                         double radius, bool draft, const Params &params,
+                         const Utils::Scheduler *sched = nullptr) {
+  typedef BlurPyramidT<T> Pyramid;
+  Pyramid pyramid(layer, 1, sched);
+  PlanarImageT<T> coarse;
+  for (int c = 2; c >= 0; --c) {
+    const int r = std::max(1, (int)std::ceil(radius * params.spread[c]));
+    int k = Pyramid::levelFor(r, draft);
+    if (k == 0 && (r >> 1) >= Pyramid::kMinResidual / 2)
+      k = 1;
+    if (k == 0) {
+      pyramid.blur(r, draft, layer, tmp, c);
+      continue;
+    }
+    pyramid.blurAt(r, k, draft, coarse);
+    pyramid.upsample(coarse, k, layer, c);
+  }
 }
 
 } // namespace Halation
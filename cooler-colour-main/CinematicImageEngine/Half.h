@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__F16C__) && defined(__AVX__)
+#include <immintrin.h>
+#define CIE_HALF_F16C 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CIE_HALF_NEON 1
+#endif
+
+/**
+ * @brief IEEE 754 binary16 conversion.
+ *
+ * Portable bit-level conversions with round-to-nearest-even, correct
+ * handling of denormals, infinities and NaN. Used for compact storage only;
+ * arithmetic always happens in float.
+ *
+ * The array forms use the hardware conversions where the build target has
+ * them (F16C on x86, 8 values per instruction; NEON on arm64, 4), which
+ * round the same way, and the scalar code for the tail.
+ */
+namespace Half {
+
+inline uint16_t fromFloat(float f) {
+  uint32_t x;
+  std::memcpy(&x, &f, sizeof(x));
+  const uint32_t sign = (x >> 16) & 0x8000u;
+  const uint32_t absx = x & 0x7FFFFFFFu;
+
+  // NaN / Inf
+  if (absx >= 0x7F800000u)
+    return (uint16_t)(sign | 0x7C00u | (absx > 0x7F800000u ? 0x200u : 0u));
+  // Overflow -> Inf
+  if (absx >= 0x477FF000u)
+    return (uint16_t)(sign | 0x7C00u);
+  // Normal half
+  if (absx >= 0x38800000u) {
+    uint32_t mant = absx & 0x007FFFFFu;
+    uint32_t exp = (absx >> 23) - 112u;
+    uint32_t h = (exp << 10) | (mant >> 13);
+    // Round to nearest even
+    uint32_t rem = mant & 0x1FFFu;
+    if (rem > 0x1000u || (rem == 0x1000u && (h & 1u)))
+      ++h;
+    return (uint16_t)(sign | h);
+  }
+  // Denormal half (or zero)
+  if (absx < 0x33000000u)
+    return (uint16_t)sign;
+  const uint32_t exp = absx >> 23;
+  const uint32_t mant = (absx & 0x007FFFFFu) | 0x00800000u;
+  const uint32_t shift = 126u - exp; // 14..24
+  uint32_t h = mant >> shift;
+  const uint32_t rem = mant & ((1u << shift) - 1u);
+  const uint32_t halfway = 1u << (shift - 1u);
+  if (rem > halfway || (rem == halfway && (h & 1u)))
+    ++h;
+  return (uint16_t)(sign | h);
+}
+
+inline float toFloat(uint16_t h) {
+  const uint32_t sign = (uint32_t)(h & 0x8000u) << 16;
+  uint32_t exp = (h >> 10) & 0x1Fu;
+  uint32_t mant = h & 0x3FFu;
+  uint32_t x;
+
+  if (exp == 0x1Fu) {
+    x = sign | 0x7F800000u | (mant << 13); // Inf / NaN
+  } else if (exp != 0) {
+    x = sign | ((exp + 112u) << 23) | (mant << 13);
+  } else if (mant == 0) {
+    x = sign; // Zero
+  } else {
+    // Denormal: renormalise
+    exp = 113u;
+    while (!(mant & 0x400u)) {
+      mant <<= 1;
+      --exp;
+    }
+    x = sign | (exp << 23) | ((mant & 0x3FFu) << 13);
+  }
+
+  float f;
+  std::memcpy(&f, &x, sizeof(f));
+  return f;
+}
+
+inline void fromFloat(const float *src, uint16_t *dst, size_t n) {
+  size_t i = 0;
+#if defined(CIE_HALF_F16C)
+  for (; i + 8 <= n; i += 8)
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i *>(dst + i),
+        _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+#elif defined(CIE_HALF_NEON)
+  for (; i + 4 <= n; i += 4)
+    vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+#endif
+  for (; i < n; ++i)
+    dst[i] = fromFloat(src[i]);
+}
+
+inline void toFloat(const uint16_t *src, float *dst, size_t n) {
+  size_t i = 0;
+#if defined(CIE_HALF_F16C)
+  for (; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(dst + i,
+                     _mm256_cvtph_ps(_mm_loadu_si128(
+                         reinterpret_cast<const __m128i *>(src + i))));
+#elif defined(CIE_HALF_NEON)
+  for (; i + 4 <= n; i += 4)
+    vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+#endif
+  for (; i < n; ++i)
+    dst[i] = toFloat(src[i]);
+}
+
+} // namespace Half
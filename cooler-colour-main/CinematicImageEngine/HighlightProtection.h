@@ -3,6 +3,8 @@
 #include <cmath>
 #include <algorithm>
 
+#include "CurveTable.h"
+
 /**
  * @brief Highlight Protection Module (Simplified).
  *
@@ -23,7 +25,32 @@ public:
         bool preserveColor;    // Toggle
     };
 
+    // Roll-off curve: identity below threshold, x / (1 + k(x - t)) above
+    static float compress(float val, const Params& params)
+    {
+        if (val < params.threshold) return val;
+        float diff = val - (float)params.threshold;
+        return val / (1.0f + (float)params.rolloff * diff);
+    }
+
+    // Bake the roll-off for processPixel(..., curve). Left empty when the
+    // threshold is above the table, where the curve is the identity.
+    static void bakeCurve(CurveTable::Table& curve, const Params& params)
+    {
+        if (params.threshold >= (double)(1 << CurveTable::kMaxExp))
+            curve.data.clear();
+        else
+            CurveTable::bake(curve, [&](float v) { return compress(v, params); });
+    }
+
     static void processPixel(float* r, float* g, float* b, const Params& params)
+    {
+        static const CurveTable::Table kNoCurve;
+        processPixel(r, g, b, params, kNoCurve);
+    }
+
+    static void processPixel(float* r, float* g, float* b, const Params& params,
+                             const CurveTable::Table& curve)
     {
         float R = *r;
         float G = *g;
@@ -45,17 +72,17 @@ public:
         // Previous logic: L_compressed = L / (1 + rolloff * (L-thresh)).
         // This is effectively scaling L down when it exceeds threshold.
 
-        auto compress = [&](float val) -> float {
+        auto apply = [&](float val) -> float {
+            float out;
             if (val < params.threshold) return val;
-            float diff = val - (float)params.threshold;
-            return val / (1.0f + (float)params.rolloff * diff);
+            return CurveTable::lookup(curve, val, out) ? out : compress(val, params);
         };
 
         if (params.preserveColor)
         {
             // Luminance Only
             float L = 0.2126f * R + 0.7152f * G + 0.0722f * B;
-            float L_new = compress(L);
+            float L_new = apply(L);
 
             float ratio = L_new / std::max(L, epsilon);
             *r = R * ratio;
@@ -65,9 +92,9 @@ public:
         else
         {
             // Per Channel
-            *r = compress(R);
-            *g = compress(G);
-            *b = compress(B);
+            *r = apply(R);
+            *g = apply(G);
+            *b = apply(B);
         }
     }
 };
@@ -0,0 +1,754 @@
+#include "Pipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "FrameCache.h"
+#include "PlanarImage.h"
+#include "Utils.h"
+
+void Pipeline::applyColorChain(float &r, float &g, float &b) const {
+  // 1. Color Ingest Tweaks
+  if (cit.enable)
+    ColorIngestTweaks::process(&r, &g, &b, cit);
+
+  // 2. Photochemical Color Response
+  if (pcr.enable)
+    FilmResponse::processPixel(&r, &g, &b, pcr);
+
+  // 3. Tonal Engine
+  TonalEngine::processPixel(&r, &g, &b, tonal, _tonalCurve);
+
+  // 4. Color Energy Engine
+  if (energy.enable)
+    ColorEnergyEngine::process(&r, &g, &b, energy);
+
+  // 5. Highlight Protection
+  HighlightProtection::processPixel(&r, &g, &b, hlp, _hlpCurve);
+
+  // 6. Split Toning
+  if (split.enable)
+    SplitToning::processPixel(&r, &g, &b, split);
+}
+
+constexpr uint32_t Pipeline::kRenderVersion;
+
+uint64_t Pipeline::paramHash() const {
+#if defined(CIE_FAST_MATH) && CIE_FAST_MATH
+  const uint32_t fastMath = 1;
+#else
+  const uint32_t fastMath = 0;
+#endif
+  uint64_t h = FrameCache::hashValue(kRenderVersion, 0xcbf29ce484222325ull);
+  h = FrameCache::hashValue(fastMath, h);
+  h = FrameCache::hashValue(cit, h);
+  h = FrameCache::hashValue(pcr, h);
+  h = FrameCache::hashValue(tonal, h);
+  h = FrameCache::hashValue(energy, h);
+  h = FrameCache::hashValue(hlp, h);
+  h = FrameCache::hashValue(split, h);
+  h = FrameCache::hashValue(grain, h);
+  h = FrameCache::hashValue(dither, h);
+  h = FrameCache::hashValue(mist, h);
+  h = FrameCache::hashValue(blur, h);
+  h = FrameCache::hashValue(glow, h);
+  h = FrameCache::hashValue(streak, h);
+  h = FrameCache::hashValue(sharp, h);
+  h = FrameCache::hashValue(halo, h);
+  h = FrameCache::hashValue(ca, h);
+  h = FrameCache::hashValue(vig, h);
+  h = FrameCache::hashValue(_quality, h);
+  h = FrameCache::hashValue(_halfSources, h);
+  return FrameCache::hashValue(_rod, h);
+}
+
+float Pipeline::grainCellScale() const {
+  const int imgW = (int)(_rod.x2 - _rod.x1);
+  const int imgH = (int)(_rod.y2 - _rod.y1);
+  const float scale = FilmGrain::cellScale(imgW, imgH, grain);
+  // Draft samples grain on a grid no finer than 2 px
+  return _quality == eQualityDraft ? std::max(2.0f, scale) : scale;
+}
+
+int Pipeline::grainSeed() const {
+  const int frameSeed = grain.enable ? (int)std::floor(_time * 24.0) : 0;
+  return FilmGrain::effectiveSeed(frameSeed, grain);
+}
+
+void Pipeline::prepareFrame() {
+  // Luminance curves first — the Draft table bakes through them
+  TonalEngine::bakeCurve(_tonalCurve, tonal);
+  HighlightProtection::bakeCurve(_hlpCurve, hlp);
+
+  if (_quality == eQualityDraft) {
+    ColorTable::bake(_colorTable, [this](float &r, float &g, float &b) {
+      applyColorChain(r, g, b);
+    });
+  } else {
+    _colorTable.data.clear();
+  }
+
+  // Grain field over the RoD plus a margin for the usual apron. Classic
+  // cells beyond it are hashed on the fly; Organic clamps to its edge.
+  // Organic needs the field even without a cache — build a one-off.
+  _grainField.reset();
+  const bool organic = grain.model == FilmGrain::GM_ORGANIC;
+  if ((_grainCache || organic) && grain.enable && grain.amount > 0.0f) {
+    const float scale = grainCellScale();
+    const float margin = 128.0f;
+    // Round outward in cell space: negative lower bounds must floor, not
+    // truncate toward zero
+    const int x0 = (int)std::floor((_rod.x1 - margin) / scale);
+    const int y0 = (int)std::floor((_rod.y1 - margin) / scale);
+    const int x1 = (int)std::ceil((_rod.x2 + margin) / scale) + 1;
+    const int y1 = (int)std::ceil((_rod.y2 + margin) / scale) + 1;
+    GrainField oneOff;
+    GrainField *cache = _grainCache ? _grainCache : &oneOff;
+    _grainField = cache->acquire(grainSeed(), grain.chromatic, grain.model,
+                                 grain.grainType, x0, y0, x1, y1);
+  }
+}
+
+Pipeline::Radii Pipeline::radii() const {
+  Radii r;
+  r.mist = mist.enable ? 6.0f * (float)_renderScaleX : 0.0f;
+  r.blur = blur.enable ? (float)(blur.blurRadius * _renderScaleX) : 0.0f;
+  r.glow = glow.enable ? (float)(glow.radius * _renderScaleX) : 0.0f;
+  r.halo = halo.enable ? (float)(halo.radius * _renderScaleX) : 0.0f;
+  r.sharp =
+      sharp.enable ? (float)Sharpening::reach(sharp, _renderScaleX) : 0.0f;
+  r.streak =
+      streak.enable ? std::max(1, (int)(streak.length * 80.0 * _renderScaleX))
+                    : 0;
+  r.defocus = 0.0f;
+  if (vig.enable && vig.type == Vignette::eDefocus) {
+    r.defocus = (float)(vig.defocusSoftness * 20.0 * _renderScaleX);
+  }
+
+  if (r.halo > 50.0f)
+    r.halo = 50.0f;
+  if (r.blur < 0.0f)
+    r.blur = 0.0f;
+  return r;
+}
+
+float Pipeline::spatialReach(const Radii &rad) const {
+  const bool draft = (_quality == eQualityDraft);
+  // Each blur's full support in this tier (see BlurPyramid::reach)
+  auto blurReach = [&](float r) {
+    return (float)BlurPyramid::reach(std::max(1, (int)std::ceil(r)), draft);
+  };
+  float totalR = 0.0f;
+  if (mist.enable)
+    totalR = std::max(totalR, blurReach(rad.mist));
+  if (blur.enable)
+    totalR += blurReach(rad.blur);
+  if (halo.enable)
+    totalR += blurReach(rad.halo * (float)Halation::maxSpread(halo));
+  if (glow.enable)
+    totalR += blurReach(rad.glow);
+  if (sharp.enable)
+    totalR += rad.sharp;
+  if (rad.defocus > 0)
+    totalR += rad.defocus;
+  return totalR;
+}
+
+int Pipeline::apron() const {
+  return (int)std::ceil(spatialReach(radii())) + 2;
+}
+
+void Pipeline::processWindow(const ImageView &src, const ImageView &dst,
+                             const Rect &p_ProcWindow) const {
+  if (!src.data || !dst.data)
+    return;
+
+  const bool draft = (_quality == eQualityDraft);
+  const bool anySpatial = mist.enable || blur.enable || glow.enable ||
+                          streak.enable || sharp.enable || halo.enable ||
+                          ca.enable;
+
+  // ========================================================================
+  // PRE-COMPUTE per-frame constants (moved out of pixel loop)
+  // ========================================================================
+  const int imgW = (int)(_rod.x2 - _rod.x1);
+  const int imgH = (int)(_rod.y2 - _rod.y1);
+
+  // Draft: Stage 0 from the baked table
+  const bool useTable = draft && !_colorTable.data.empty();
+  const bool grainOn = grain.enable && grain.amount > 0.0f;
+  const float grainScale = grainCellScale();
+  const int seed = grainSeed();
+  const GrainField::Field *field = _grainField.get();
+  // Organic falls back to Classic if its field was too large to build
+  const bool organic =
+      grainOn && field && field->model == FilmGrain::GM_ORGANIC;
+  const float invGrainScale = 1.0f / grainScale;
+  const int ditherFrame = (int)std::floor(_time);
+  std::vector<float> organicRow; // field resampled to the current row
+
+  // Vignette mask coordinates (normalised over the source RoD)
+  const float vImgW = (float)imgW;
+  const float vImgH = (float)imgH;
+  const float aspect = vImgW / std::max(1.0f, vImgH);
+  const float invW = 1.0f / vImgW;
+  const float invH = 1.0f / vImgH;
+  const float rodX1 = (float)_rod.x1;
+  const float rodY1 = (float)_rod.y1;
+
+  // ========================================================================
+  // STAGE 0: Per-Pixel Pipeline, one row at a time
+  // Order: CIT -> PCR -> Tonal -> Energy -> HLP -> Split -> Grain -> Dither
+  // Reads n source pixels from (gx0, gy), clamped to the source bounds, and
+  // writes channel values `stride` floats apart: interleaved RGBA straight
+  // into the destination, or planar RGB (outA null) into the apron buffer.
+  // ========================================================================
+  const Rect srcBounds = src.bounds;
+  const bool haveSrc =
+      srcBounds.x2 > srcBounds.x1 && srcBounds.y2 > srcBounds.y1;
+
+  auto stage0Row = [&](int gx0, int gy, int n, float *outR, float *outG,
+                       float *outB, float *outA, int stride) {
+    const float *srcRow = nullptr;
+    if (haveSrc) {
+      const int cy = std::min(std::max(gy, srcBounds.y1), srcBounds.y2 - 1);
+      srcRow = src.pixel(srcBounds.x1, cy);
+    }
+    const int cellY = int(gy / grainScale);
+    const float *fieldRow = field && !organic ? field->row(cellY) : nullptr;
+    int lastCellX = 0;
+    bool haveCell = false;
+    float noise[3] = {0.0f, 0.0f, 0.0f};
+
+    // Organic: vertical Catmull-Rom pass over the cells this row touches,
+    // the horizontal pass runs per pixel. Cell centres sit at (i + 0.5) *
+    // scale.
+    int orgX0 = 0, orgX1 = 0;
+    if (organic) {
+      const int ch = field->channels;
+      const float v = (gy + 0.5f) * invGrainScale - 0.5f;
+      const int j = (int)std::floor(v);
+      float wy[4];
+      FilmGrain::cubicWeights(v - j, wy);
+      const float *rows[4];
+      for (int k = 0; k < 4; ++k)
+        rows[k] = field->row(
+            std::min(std::max(j - 1 + k, field->y0), field->y1 - 1));
+
+      orgX0 = (int)std::floor((gx0 + 0.5f) * invGrainScale - 0.5f) - 1;
+      orgX1 = (int)std::floor((gx0 + n - 0.5f) * invGrainScale - 0.5f) + 3;
+      orgX0 = std::min(std::max(orgX0, field->x0), field->x1 - 1);
+      orgX1 = std::min(std::max(orgX1, orgX0 + 1), field->x1);
+      organicRow.resize((size_t)(orgX1 - orgX0) * ch);
+      for (int cx = orgX0; cx < orgX1; ++cx) {
+        const size_t off = (size_t)(cx - field->x0) * ch;
+        for (int c = 0; c < ch; ++c)
+          organicRow[(size_t)(cx - orgX0) * ch + c] =
+              wy[0] * rows[0][off + c] + wy[1] * rows[1][off + c] +
+              wy[2] * rows[2][off + c] + wy[3] * rows[3][off + c];
+      }
+    }
+
+    for (int x = 0; x < n; ++x) {
+      const int gx = gx0 + x;
+      float r = 0.0f, g = 0.0f, b = 0.0f;
+      if (srcRow) {
+        const int cx = std::min(std::max(gx, srcBounds.x1), srcBounds.x2 - 1);
+        const float *p = srcRow + (size_t)(cx - srcBounds.x1) * 4;
+        r = p[0];
+        g = p[1];
+        b = p[2];
+      }
+
+      // 1-6. Colour chain
+      if (!useTable || !ColorTable::lookup(_colorTable, r, g, b))
+        applyColorChain(r, g, b);
+
+      // 7. Film Grain
+      if (grainOn) {
+        const int cellX = int(gx / grainScale);
+        const float *cellNoise = noise;
+        if (organic) {
+          const int ch = field->channels;
+          const float u = (gx + 0.5f) * invGrainScale - 0.5f;
+          const int i = (int)std::floor(u);
+          float wx[4];
+          FilmGrain::cubicWeights(u - i, wx);
+          for (int c = 0; c < ch; ++c) {
+            float acc = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+              const int cx = std::min(std::max(i - 1 + k, orgX0), orgX1 - 1);
+              acc += wx[k] * organicRow[(size_t)(cx - orgX0) * ch + c];
+            }
+            noise[c] = acc;
+          }
+        } else if (fieldRow && cellX >= field->x0 && cellX < field->x1) {
+          cellNoise = fieldRow + (size_t)(cellX - field->x0) * field->channels;
+        } else if (!haveCell || cellX != lastCellX) {
+          // Outside the cached field: hash, reusing the last cell along
+          // the row
+          FilmGrain::sampleCell(cellX, cellY, seed, grain.chromatic, noise);
+          lastCellX = cellX;
+          haveCell = true;
+        }
+        FilmGrain::applyNoise(&r, &g, &b, cellNoise, grain);
+      }
+
+      // 8. Dither (banding reduction)
+      if (dither.enable)
+        Dither::process(&r, &g, &b, gx, gy, dither, ditherFrame);
+
+      // Store
+      const size_t o = (size_t)x * stride;
+      outR[o] = r;
+      outG[o] = g;
+      outB[o] = b;
+      if (outA)
+        outA[o] = 1.0f;
+    }
+  };
+
+  // Vignette, in place over n output pixels starting at (gx0, gy)
+  auto vignetteRow = [&](float *row, int gx0, int gy, int n) {
+    const float v = ((float)gy - rodY1) * invH;
+    for (int x = 0; x < n; ++x) {
+      const float u = ((float)(gx0 + x) - rodX1) * invW;
+      const float V = Vignette::computeMask(u, v, aspect, vig);
+      float *d = row + x * 4;
+      Vignette::processPixel(d, d + 1, d + 2, V, vig);
+    }
+  };
+
+  // ========================================================================
+  // DIRECT PATH  –  colour-only grades. Vignette is pointwise, so nothing
+  // needs neighbours: no apron, no intermediate buffer, one pass per row
+  // straight into the destination.
+  // ========================================================================
+  if (!anySpatial) {
+    const int dstWidth = p_ProcWindow.x2 - p_ProcWindow.x1;
+    for (int gy = p_ProcWindow.y1; gy < p_ProcWindow.y2; ++gy) {
+      float *dstRow = dst.pixel(p_ProcWindow.x1, gy);
+      if (!dstRow)
+        continue;
+      stage0Row(p_ProcWindow.x1, gy, dstWidth, dstRow, dstRow + 1, dstRow + 2,
+                dstRow + 3, 4);
+      if (vig.enable)
+        vignetteRow(dstRow, p_ProcWindow.x1, gy, dstWidth);
+    }
+    return;
+  }
+
+  // ========================================================================
+  // APRON CALCULATION
+  // ========================================================================
+  const Radii rad = radii();
+  const float mistR = rad.mist, blurR = rad.blur, glowR = rad.glow,
+              haloR = rad.halo;
+  const int sLen = rad.streak;
+
+  float totalR = spatialReach(rad);
+  // CA resamples the finished image around the output window only
+  if (ca.enable) {
+    const ChromaticAberration::Margins m = ChromaticAberration::margins(
+        ca, _rod.x1, _rod.y1, imgW, imgH, p_ProcWindow.x1, p_ProcWindow.y1,
+        p_ProcWindow.x2, p_ProcWindow.y2);
+    totalR += (float)std::max(std::max(m.x1, m.x2), std::max(m.y1, m.y2));
+  }
+
+  const int apron = (int)std::ceil(totalR) + 2;
+
+  Rect bufARect = p_ProcWindow;
+  bufARect.x1 -= apron;
+  bufARect.x2 += apron;
+  bufARect.y1 -= apron;
+  bufARect.y2 += apron;
+
+  // The streak only widens the apron along its arms (a plain streak only
+  // horizontally). Past the source edge it would see copies of the edge
+  // pixels, which the streak blur's own edge extension already supplies, so
+  // it stops there.
+  if (streak.enable) {
+    int reachX, reachY;
+    AnamorphicStreak::reachXY(streak, _renderScaleX, reachX, reachY);
+    int x1 = bufARect.x1 - reachX, x2 = bufARect.x2 + reachX;
+    int y1 = bufARect.y1 - reachY, y2 = bufARect.y2 + reachY;
+    if (haveSrc) {
+      x1 = std::max(x1, std::min(p_ProcWindow.x1, srcBounds.x1) - apron);
+      x2 = std::min(x2, std::max(p_ProcWindow.x2, srcBounds.x2) + apron);
+      y1 = std::max(y1, std::min(p_ProcWindow.y1, srcBounds.y1) - apron);
+      y2 = std::min(y2, std::max(p_ProcWindow.y2, srcBounds.y2) + apron);
+    }
+    bufARect.x1 = std::min(bufARect.x1, x1);
+    bufARect.x2 = std::max(bufARect.x2, x2);
+    bufARect.y1 = std::min(bufARect.y1, y1);
+    bufARect.y2 = std::max(bufARect.y2, y2);
+  }
+
+  // Pyramid levels, Draft's half-resolution grids and the coarse grids
+  // Dreamy Blur upsamples from are all decimated from the buffer origin.
+  // Snapping the buffer outward to global multiples of the coarsest level
+  // puts every one of them on the same global grid, whatever window the
+  // host asks for, so tiled renders match full-frame ones. The pixels
+  // added lie past the apron and do not reach the window.
+  {
+    const int kAlign = 1 << BlurPyramid::kMaxLevel;
+    auto down = [&](int v) {
+      return (v >= 0 ? v / kAlign : -((kAlign - 1 - v) / kAlign)) * kAlign;
+    };
+    bufARect.x1 = down(bufARect.x1);
+    bufARect.y1 = down(bufARect.y1);
+    bufARect.x2 = -down(-bufARect.x2);
+    bufARect.y2 = -down(-bufARect.y2);
+  }
+
+  const int bufAW = bufARect.x2 - bufARect.x1;
+  const int bufAH = bufARect.y2 - bufARect.y1;
+
+  // ========================================================================
+  // BUFFER ALLOCATION  –  planar RGB (no alpha until write-out), single
+  // shared temp buffer for ALL blur operations
+  // ========================================================================
+  PlanarImage bufA(bufAW, bufAH);
+  float *const aR = bufA.plane(0), *const aG = bufA.plane(1),
+               *const aB = bufA.plane(2);
+
+  // Effect sources (Mist, Glow, Streak, Halation) are smooth, blurred and
+  // added back, so with _halfSources they live in fp16 (bufBh / bufTempH),
+  // halving the traffic of their blur passes. Blur, Sharpening and CA work
+  // on copies of the image itself and stay fp32 (bufB / bufTemp). Mist and
+  // Halation sources are one plane (energy, tinted after the blur); Spectral
+  // Halation blurs it into three.
+  const bool sourceFx =
+      mist.enable || glow.enable || streak.enable || halo.enable;
+  const bool spectralHalo = halo.enable && halo.mode == Halation::eSpectral;
+  const bool halfSources = _halfSources && sourceFx;
+  PlanarImage bufB, bufTemp;
+  if (!halfSources || blur.enable || sharp.enable || ca.enable) {
+    bufB.allocate(bufAW, bufAH);
+    bufTemp.allocate(bufAW, bufAH);
+  }
+  PlanarImageHalf bufBh, bufTempH;
+  if (halfSources) {
+    const int planes = glow.enable || streak.enable || spectralHalo ? 3 : 1;
+    bufBh.allocate(bufAW, bufAH, planes);
+    bufTempH.allocate(bufAW, bufAH, planes);
+  }
+  std::vector<float> rowScratch((size_t)3 * bufAW); // fp16 rows as float
+
+  // Blur the first `planes` planes of a layer in place through a pyramid
+  // of its own: the radius's level plus a residual blur, upsampled back
+  // (Draft: one level coarser, one box pass)
+  auto blurLayer = [&](auto &layer, auto &tmp, int r, int planes) {
+    pyramidBlur(layer, tmp, r, draft, planes, _scheduler);
+  };
+
+  // Calls fn(layer, tmp) with the buffers effect sources use
+  auto withSourceLayer = [&](auto fn) {
+    if (halfSources)
+      fn(bufBh, bufTempH);
+    else
+      fn(bufB, bufTemp);
+  };
+
+  // Fill a layer from bufA: compute(i, r, g, b) writes pixel i's source
+  // into float rows, narrowed to the layer's storage row by row
+  auto extractLayer = [&](auto &layer, auto compute) {
+    for (int y = 0; y < bufAH; ++y) {
+      float *o[3];
+      for (int c = 0; c < 3; ++c)
+        o[c] = Utils::rowTarget(layer.row(c, y), rowScratch.data() + c * bufAW);
+      const size_t base = (size_t)y * bufAW;
+      for (int x = 0; x < bufAW; ++x)
+        compute(base + x, o[0][x], o[1][x], o[2][x]);
+      for (int c = 0; c < 3; ++c) {
+        Utils::saturateRow(layer.row(c, y), o[c], bufAW);
+        Utils::narrowRow(layer.row(c, y), o[c], bufAW);
+      }
+    }
+  };
+
+  // Fill plane 0 of a layer from bufA: compute(i) returns pixel i's source
+  auto extractPlane = [&](auto &layer, auto compute) {
+    for (int y = 0; y < bufAH; ++y) {
+      float *o = Utils::rowTarget(layer.row(0, y), rowScratch.data());
+      const size_t base = (size_t)y * bufAW;
+      for (int x = 0; x < bufAW; ++x)
+        o[x] = compute(base + x);
+      Utils::saturateRow(layer.row(0, y), o, bufAW);
+      Utils::narrowRow(layer.row(0, y), o, bufAW);
+    }
+  };
+
+  // Composite a layer into bufA: apply(i, r, g, b) gets pixel i's layer value
+  auto applyLayer = [&](const auto &layer, auto apply) {
+    for (int y = 0; y < bufAH; ++y) {
+      const float *l[3];
+      for (int c = 0; c < 3; ++c)
+        l[c] = Utils::widenRow(layer.row(c, y), rowScratch.data() + c * bufAW,
+                               bufAW);
+      const size_t base = (size_t)y * bufAW;
+      for (int x = 0; x < bufAW; ++x)
+        apply(base + x, l[0][x], l[1][x], l[2][x]);
+    }
+  };
+
+  // Composite plane 0 of a layer into bufA: apply(i, v) gets pixel i's value
+  auto applyPlane = [&](const auto &layer, auto apply) {
+    for (int y = 0; y < bufAH; ++y) {
+      const float *l =
+          Utils::widenRow(layer.row(0, y), rowScratch.data(), bufAW);
+      const size_t base = (size_t)y * bufAW;
+      for (int x = 0; x < bufAW; ++x)
+        apply(base + x, l[x]);
+    }
+  };
+
+  // Stage 0 over the whole apron
+  for (int y = 0; y < bufAH; ++y)
+    stage0Row(bufARect.x1, bufARect.y1 + y, bufAW, bufA.row(0, y),
+              bufA.row(1, y), bufA.row(2, y), nullptr, 1);
+
+  // ========================================================================
+  // STAGE 1: Spatial Effects  –  reusing bufTemp across all effects
+  // ========================================================================
+
+  const int dstWidth = p_ProcWindow.x2 - p_ProcWindow.x1;
+  const int dstHeight = p_ProcWindow.y2 - p_ProcWindow.y1;
+  const int axOff = p_ProcWindow.x1 - bufARect.x1;
+  const int ayOff = p_ProcWindow.y1 - bufARect.y1;
+
+  // The composite of the last blur-based stage only needs the output window
+  // when nothing spatial follows it, so it is deferred to the write-out pass
+  // (CA resamples neighbours and must see the composited apron). Dreamy
+  // Blur and Sharpening apply their blend as they upsample or blur, so when
+  // last they simply run over the output window itself.
+  enum Deferred { eNone, eMist, eGlow, eStreak, eHalo };
+  int deferred = eNone;
+  if (!ca.enable) {
+    if (halo.enable)
+      deferred = eHalo;
+    else if (sharp.enable)
+      deferred = eNone;
+    else if (streak.enable)
+      deferred = eStreak;
+    else if (glow.enable)
+      deferred = eGlow;
+    else if (blur.enable)
+      deferred = eNone;
+    else if (mist.enable)
+      deferred = eMist;
+  }
+  // Layer the deferred composite reads: fp32 or fp16
+  struct DeferredLayer {
+    const PlanarImage *f = nullptr;
+    const PlanarImageHalf *h = nullptr;
+    void set(const PlanarImage &layer) { f = &layer; }
+    void set(const PlanarImageHalf &layer) { h = &layer; }
+  } deferredLayer;
+
+  // Mist
+  if (mist.enable) {
+    const int r = std::max(1, (int)std::ceil(mistR));
+    withSourceLayer([&](auto &layer, auto &tmp) {
+      extractPlane(layer, [&](size_t i) {
+        return DreamyMist::computeMistSource(aR[i], aG[i], aB[i], mist);
+      });
+      blurLayer(layer, tmp, r, 1);
+      if (deferred == eMist)
+        deferredLayer.set(layer);
+      else
+        applyPlane(layer, [&](size_t i, float m) {
+          DreamyMist::applyMist(aR[i], aG[i], aB[i], m, mist);
+        });
+    });
+  }
+
+  // Dreamy Blur — luma only, blurred at reduced resolution and blended as
+  // it is upsampled; the whole apron only if a spatial stage follows
+  if (blur.enable) {
+    const int r = std::max(1, (int)std::ceil(blurR));
+    if (glow.enable || streak.enable || sharp.enable || halo.enable ||
+        ca.enable)
+      DreamyBlur::process(bufA, bufB, bufTemp, 0, 0, bufAW, bufAH, r, draft,
+                          blur, _scheduler);
+    else
+      DreamyBlur::process(bufA, bufB, bufTemp, axOff, ayOff, axOff + dstWidth,
+                          ayOff + dstHeight, r, draft, blur, _scheduler);
+  }
+
+  // Cinematic Glow
+  if (glow.enable) {
+    const int r = std::max(1, (int)std::ceil(glowR));
+    withSourceLayer([&](auto &layer, auto &tmp) {
+      extractLayer(layer, [&](size_t i, float &sr, float &sg, float &sb) {
+        CinematicGlow::computeGlowSource(aR[i], aG[i], aB[i], sr, sg, sb,
+                                         glow);
+      });
+      // Bloom: a falloff of octaves up to the radius, from one pyramid
+      if (glow.mode == CinematicGlow::eBloom)
+        CinematicGlow::bloom(layer, tmp, glowR, draft, glow, _scheduler);
+      else
+        blurLayer(layer, tmp, r, 3);
+      if (deferred == eGlow)
+        deferredLayer.set(layer);
+      else
+        applyLayer(layer, [&](size_t i, float lr, float lg, float lb) {
+          CinematicGlow::applyGlow(aR[i], aG[i], aB[i], lr, lg, lb, glow);
+        });
+    });
+  }
+
+  // Anamorphic Streak
+  if (streak.enable) {
+    withSourceLayer([&](auto &layer, auto &tmp) {
+      extractLayer(layer, [&](size_t i, float &sr, float &sg, float &sb) {
+        AnamorphicStreak::computeStreakSource(aR[i], aG[i], aB[i], sr, sg, sb,
+                                              streak);
+      });
+      // Three boxes in one pass per row (Draft: one of the same variance),
+      // or per line of each arm for a star
+      if (AnamorphicStreak::isStar(streak))
+        AnamorphicStreak::star(layer, tmp, streak, _renderScaleX, draft,
+                               bufARect.x1, bufARect.y1, _scheduler);
+      else
+        AnamorphicStreak::blur(layer, tmp, sLen, draft, _scheduler);
+      // Result is in tmp — composite straight from there
+      if (deferred == eStreak)
+        deferredLayer.set(tmp);
+      else
+        applyLayer(tmp, [&](size_t i, float lr, float lg, float lb) {
+          AnamorphicStreak::applyStreak(aR[i], aG[i], aB[i], lr, lg, lb,
+                                        streak);
+        });
+    });
+  }
+
+  // Sharpening — blurred luma and detail in one pass over bufA (bufB holds
+  // the luma planes); the whole apron only if a spatial stage follows
+  if (sharp.enable) {
+    if (halo.enable || ca.enable)
+      Sharpening::process(bufA, bufB, bufTemp, 0, 0, bufAW, bufAH, sharp,
+                          _renderScaleX, _scheduler);
+    else
+      Sharpening::process(bufA, bufB, bufTemp, axOff, ayOff, axOff + dstWidth,
+                          ayOff + dstHeight, sharp, _renderScaleX, _scheduler);
+  }
+
+  // Halation
+  if (halo.enable) {
+    const int r = std::max(1, (int)std::ceil(haloR));
+    withSourceLayer([&](auto &layer, auto &tmp) {
+      extractPlane(layer, [&](size_t i) {
+        return Halation::computeHalationSource(aR[i], aG[i], aB[i], halo);
+      });
+      if (spectralHalo) {
+        // One radius per channel, all from the energy's pyramid
+        Halation::spectralBlur(layer, tmp, haloR, draft, halo, _scheduler);
+        if (deferred == eHalo)
+          deferredLayer.set(layer);
+        else
+          applyLayer(layer, [&](size_t i, float er, float eg, float eb) {
+            Halation::applyHalation(&aR[i], &aG[i], &aB[i], er, eg, eb, halo);
+          });
+        return;
+      }
+      blurLayer(layer, tmp, r, 1);
+      if (deferred == eHalo)
+        deferredLayer.set(layer);
+      else
+        applyPlane(layer, [&](size_t i, float e) {
+          Halation::applyHalation(&aR[i], &aG[i], &aB[i], e, halo);
+        });
+    });
+  }
+
+  // Chromatic Aberration — only the output window is read after it, so it
+  // is resampled from bufA into bufB there: R and B, or all three planes for
+  // Spectral
+  const float *outR = aR, *outG = aG, *outB = aB;
+  if (ca.enable) {
+    ChromaticAberration::process(bufA, bufB, (float)_rod.x1, (float)_rod.y1,
+                                 (float)imgW, (float)imgH, bufARect.x1,
+                                 bufARect.y1, axOff, ayOff, axOff + dstWidth,
+                                 ayOff + dstHeight, ca, _scheduler);
+    outR = bufB.plane(0);
+    if (ca.mode == ChromaticAberration::eSpectral)
+      outG = bufB.plane(1);
+    outB = bufB.plane(2);
+  }
+
+  // ========================================================================
+  // FINAL OUTPUT  –  deferred composite + vignette, fused with interleaving
+  // the planes into the destination (output window only). Alpha comes back
+  // here: Stage 0 always sets it to 1.0.
+  // ========================================================================
+  std::vector<float> layerScratch((size_t)3 * dstWidth); // fp16 layer rows
+
+  for (int y = 0; y < dstHeight; ++y) {
+    float *dstPix = dst.pixel(p_ProcWindow.x1, p_ProcWindow.y1 + y);
+    if (!dstPix)
+      continue;
+    const size_t rowOff = (size_t)(ayOff + y) * bufAW + axOff;
+    const float *rowR = outR + rowOff;
+    const float *rowG = outG + rowOff;
+    const float *rowB = outB + rowOff;
+
+    if (deferred == eNone) {
+      for (int x = 0; x < dstWidth; ++x) {
+        float *out = dstPix + x * 4;
+        out[0] = rowR[x];
+        out[1] = rowG[x];
+        out[2] = rowB[x];
+        out[3] = 1.0f;
+      }
+    } else {
+      // Mist and Halation layers are one plane (Spectral Halation: three)
+      const int planes =
+          deferred == eMist || (deferred == eHalo && !spectralHalo) ? 1 : 3;
+      const float *l[3] = {};
+      for (int c = 0; c < planes; ++c)
+        l[c] = deferredLayer.h ? Utils::widenRow(
+                                     deferredLayer.h->row(c, ayOff + y) + axOff,
+                                     layerScratch.data() + c * dstWidth,
+                                     dstWidth)
+                               : deferredLayer.f->row(c, ayOff + y) + axOff;
+      const float *lR = l[0], *lG = l[1], *lB = l[2];
+      for (int x = 0; x < dstWidth; ++x) {
+        float r = rowR[x];
+        float g = rowG[x];
+        float b = rowB[x];
+
+        switch (deferred) {
+        case eMist:
+          DreamyMist::applyMist(r, g, b, lR[x], mist);
+          break;
+        case eGlow:
+          CinematicGlow::applyGlow(r, g, b, lR[x], lG[x], lB[x], glow);
+          break;
+        case eStreak:
+          AnamorphicStreak::applyStreak(r, g, b, lR[x], lG[x], lB[x], streak);
+          break;
+        case eHalo:
+          if (spectralHalo)
+            Halation::applyHalation(&r, &g, &b, lR[x], lG[x], lB[x], halo);
+          else
+            Halation::applyHalation(&r, &g, &b, lR[x], halo);
+          break;
+        default:
+          break;
+        }
+
+        float *out = dstPix + x * 4;
+        out[0] = r;
+        out[1] = g;
+        out[2] = b;
+        out[3] = 1.0f;
+      }
+    }
+    // Vignette while the row is still in L1
+    if (vig.enable)
+      vignetteRow(dstPix, p_ProcWindow.x1, p_ProcWindow.y1 + y, dstWidth);
+  }
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "AnamorphicStreak.h"
+#include "BlurPyramid.h"
+#include "ChromaticAberration.h"
+#include "CinematicGlow.h"
+#include "ColorEnergyEngine.h"
+#include "ColorIngestTweaks.h"
+#include "ColorTable.h"
+#include "CurveTable.h"
+#include "Dither.h"
+#include "DreamyBlur.h"
+#include "DreamyMist.h"
+#include "FilmGrain.h"
+#include "FilmResponse.h"
+#include "GrainField.h"
+#include "Halation.h"
+#include "HighlightProtection.h"
+#include "Sharpening.h"
+#include "SplitToning.h"
+#include "TonalEngine.h"
+#include "Utils.h"
+#include "Vignette.h"
+
+// Render quality tiers (QualityMode choice param)
+//   Draft  — single box pass per blur, half-resolution spatial stages,
+//            coarse grain grid, Stage 0 from a baked 3D table.
+//   Normal — exact path, drops to Draft when the host asks for a draft or
+//            interactive render (scrubbing, slider drags).
+//   Final  — always the exact path, ignores host hints.
+enum RenderQuality { eQualityDraft = 0, eQualityNormal, eQualityFinal };
+
+/**
+ * @brief The full image pipeline, independent of any host API.
+ *
+ * Holds the per-frame parameters of every module and renders any window of
+ * the output from a source image. The OFX plugin drives it through
+ * PipelineProcessor (one window per host thread); cie_render drives it
+ * directly on image sequences.
+ *
+ * Coordinates follow OFX: integer pixel positions, y up. Images are
+ * described by a base pointer, bounds and a signed row stride, so bottom-up
+ * and top-down buffers both work without a copy.
+ */
+class Pipeline {
+public:
+  struct Rect {
+    int x1, y1, x2, y2;
+  };
+
+  struct RectD {
+    double x1, y1, x2, y2;
+  };
+
+  // RGBA float image. `data` points at pixel (bounds.x1, bounds.y1).
+  struct ImageView {
+    float *data;
+    Rect bounds;
+    ptrdiff_t rowBytes;
+
+    float *pixel(int x, int y) const {
+      if (x < bounds.x1 || x >= bounds.x2 || y < bounds.y1 || y >= bounds.y2)
+        return nullptr;
+      char *row = reinterpret_cast<char *>(data) + (y - bounds.y1) * rowBytes;
+      return reinterpret_cast<float *>(row) + (size_t)(x - bounds.x1) * 4;
+    }
+  };
+
+  Pipeline()
+      : cit(), pcr(), tonal(), energy(), hlp(), split(), grain(), dither(),
+        mist(), blur(), glow(), streak(), sharp(), halo(), ca(), vig(),
+        _renderScaleX(1.0), _time(0.0), _rod{0, 0, 0, 0},
+        _quality(eQualityFinal), _halfSources(false), _grainCache(nullptr),
+        _scheduler(nullptr) {}
+
+  void setRenderScale(double scaleX) { _renderScaleX = scaleX; }
+  void setTime(double t) { _time = t; }
+  void setSourceRoD(const RectD &rod) { _rod = rod; }
+  void setQuality(int quality) { _quality = quality; }
+  // Optional; without one the grain is hashed per cell every frame.
+  void setGrainCache(GrainField *cache) { _grainCache = cache; }
+  // Optional; lets the blurs split rows / column strips across workers
+  // (output is identical to the serial path). Must outlive rendering.
+  void setScheduler(const Utils::Scheduler *sched) { _scheduler = sched; }
+  // Keep the Mist / Glow / Streak / Halation sources in fp16 (blur sums
+  // stay fp32). Halves their memory traffic; see processWindow.
+  void setHalfSources(bool on) { _halfSources = on; }
+
+  // Per-frame preparation — call once after params are populated,
+  // before rendering any window. Bakes the tonal / highlight curves and the
+  // Draft Stage 0 table, and fetches the grain field.
+  void prepareFrame();
+
+  // Version of the rendering algorithms, salted into paramHash() so frames
+  // an older build left in a persistent cache are not served after an
+  // upgrade. Bump it with every change that moves the output for the same
+  // parameters.
+  static constexpr uint32_t kRenderVersion = 7;
+
+  // Hash of every value that affects the rendered pixels (frame cache key),
+  // including kRenderVersion and the build options that change output.
+  // The Params structs are value-initialised in the constructor so their
+  // padding bytes are zero and can be hashed directly.
+  uint64_t paramHash() const;
+
+  // Render `window` of dst from src. Thread-safe for disjoint windows once
+  // prepareFrame() has run. Pixels outside src bounds clamp to the edge.
+  void processWindow(const ImageView &src, const ImageView &dst,
+                     const Rect &window) const;
+
+  // Pixels processWindow reads around its window for the spatial stages in
+  // the current tier, not counting the streak's arms or CA. Windows much
+  // shorter than twice this spend most of their time on the apron.
+  int apron() const;
+
+  // Params
+  ColorIngestTweaks::Params cit;
+  FilmResponse::Params pcr;
+  TonalEngine::Params tonal;
+  ColorEnergyEngine::Params energy;
+  HighlightProtection::Params hlp;
+  SplitToning::Params split;
+  FilmGrain::Params grain;
+
+  Dither::Params dither;
+
+  // Spatial
+  DreamyMist::Params mist;
+  DreamyBlur::Params blur;
+  CinematicGlow::Params glow;
+  AnamorphicStreak::Params streak;
+  Sharpening::Params sharp;
+  Halation::Params halo;
+  ChromaticAberration::Params ca;
+  Vignette::Params vig;
+
+private:
+  // Position-independent Stage 0 modules (CIT -> PCR -> Tonal -> Energy ->
+  // HLP -> Split). Grain and Dither depend on pixel position.
+  void applyColorChain(float &r, float &g, float &b) const;
+
+  // Effect radii at the current render scale, in pixels
+  struct Radii {
+    float mist, blur, glow, halo, sharp, defocus;
+    int streak; // Streak blur length
+  };
+  Radii radii() const;
+
+  // Combined reach of the blurs, sharpening and defocus vignette
+  float spatialReach(const Radii &rad) const;
+
+  // Grain cell size in pixels and seed for the current frame and tier
+  float grainCellScale() const;
+  int grainSeed() const;
+
+  double _renderScaleX;
+  double _time;
+  RectD _rod;
+  int _quality;
+  bool _halfSources;
+  ColorTable::Table _colorTable; // Draft only
+  CurveTable::Table _tonalCurve;
+  CurveTable::Table _hlpCurve;
+  GrainField *_grainCache;
+  const Utils::Scheduler *_scheduler;
+  std::shared_ptr<const GrainField::Field> _grainField;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * @brief Planar image used between the spatial stages.
+ *
+ * One contiguous plane per channel — R, G, B and optionally A — each
+ * starting on a 64-byte boundary, so per-channel loops run over unit-stride
+ * values and vectorise without shuffles. Stage 1 carries no alpha: it is
+ * 1.0 after Stage 0 and meaningless in an effect source, so it is added
+ * back only when the result is interleaved into the destination.
+ *
+ * T is the storage type: float, or uint16_t holding IEEE binary16 (see
+ * Half.h) for the optional fp16 effect-source layers.
+ */
+template <class T> class PlanarImageT {
+public:
+  static const int kAlign = 64 / (int)sizeof(T); // elements per 64 bytes
+
+  PlanarImageT() : _w(0), _h(0), _channels(0), _planeSize(0), _offset(0) {}
+  PlanarImageT(int w, int h, int channels = 3) : PlanarImageT() {
+    allocate(w, h, channels);
+  }
+
+  // Planes are located by offset into _storage, which a copy would not keep
+  // aligned; moves keep the allocation.
+  PlanarImageT(const PlanarImageT &) = delete;
+  PlanarImageT &operator=(const PlanarImageT &) = delete;
+  PlanarImageT(PlanarImageT &&) = default;
+  PlanarImageT &operator=(PlanarImageT &&) = default;
+
+  // (Re)size. Contents are unspecified afterwards.
+  void allocate(int w, int h, int channels = 3) {
+    _w = w;
+    _h = h;
+    _channels = channels;
+    const size_t n = (size_t)w * h;
+    _planeSize = (n + kAlign - 1) / kAlign * kAlign;
+    _storage.resize(_planeSize * channels + kAlign);
+    const size_t align = kAlign * sizeof(T);
+    const size_t mis = (uintptr_t)_storage.data() % align;
+    _offset = mis ? (align - mis) / sizeof(T) : 0;
+  }
+
+  int width() const { return _w; }
+  int height() const { return _h; }
+  int channels() const { return _channels; }
+  size_t pixels() const { return (size_t)_w * _h; }
+  bool empty() const { return _channels == 0 || pixels() == 0; }
+
+  T *plane(int c) { return _storage.data() + _offset + c * _planeSize; }
+  const T *plane(int c) const {
+    return _storage.data() + _offset + c * _planeSize;
+  }
+
+  T *row(int c, int y) { return plane(c) + (size_t)y * _w; }
+  const T *row(int c, int y) const { return plane(c) + (size_t)y * _w; }
+
+  // Copy the planes both images have; sizes must match
+  void copyFrom(const PlanarImageT &src) {
+    const int n = std::min(_channels, src._channels);
+    for (int c = 0; c < n; ++c)
+      std::memcpy(plane(c), src.plane(c), pixels() * sizeof(T));
+  }
+
+private:
+  int _w, _h, _channels;
+  size_t _planeSize; // elements per plane, padded to kAlign
+  size_t _offset;    // elements from _storage.data() to the first plane
+  std::vector<T> _storage;
+};
+
+typedef PlanarImageT<float> PlanarImage;
+typedef PlanarImageT<uint16_t> PlanarImageHalf; // binary16 bit patterns
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "PlanarImage.h"
 #include "Utils.h"
 #include <algorithm>
 #include <vector>
@@ -26,13 +27,12 @@ public:
         double highlightProtection;
     };
 
-    // New static helper to match CinematicImageEngine.cpp call
-    static void applySharpen(float& r, float& g, float& b, float bR, float bG, float bB, const Params& p) {
+    // Sharpen one pixel against bL, the blurred luma around it
+    static void applySharpen(float& r, float& g, float& b, float bL, const Params& p) {
         if (!p.enable || p.amount <= 0.0) return;
 
         // Luma only
         float L = Utils::getLuminance(r, g, b);
-        float bL = Utils::getLuminance(bR, bG, bB);
 
         // Difference (Detail)
         float detail = L - bL;
@@ -58,8 +58,9 @@ public:
         }
 
         // --- Edge Protection ---
-        if (p.type == eEdgeAware || p.edgeProtection > 0.0) {
-             float protStrength = (p.type == eEdgeAware) ? std::max(0.5f, (float)p.edgeProtection) : (float)p.edgeProtection;
+        // (Edge Aware's blur already stops at edges; see guided below)
+        if (p.type != eEdgeAware && p.edgeProtection > 0.0) {
+             float protStrength = (float)p.edgeProtection;
              float dAbs = std::abs(adjDetail);
              if (dAbs > 0.05f) {
                   float att = 1.0f / (1.0f + (dAbs - 0.05f) * protStrength * 20.0f);
@@ -90,4 +91,296 @@ public:
         g += diff;
         b += diff;
     }
+
+    // ========================================================================
+    // Blurred luma — small separable kernels
+    //
+    // applySharpen only reads the luma of the blurred image, and luma is
+    // linear in R, G and B, so the luma plane is computed once and blurred
+    // instead of the three colour planes. SharpRadius scales the Gaussian's
+    // sigma, 1.0 being the width of the fixed blur this replaces (three
+    // boxes of radius 1). Up to kMaxSigma it is a 3, 5 or 7 tap kernel cut
+    // at two sigma, run as a ring of horizontally filtered rows with the
+    // vertical taps and the sharpening applied to each row as it completes,
+    // so the image is read and written once. Larger radii halve the luma
+    // until sigma fits, blur there and come back through 2x bilinear
+    // upsamples.
+    // ========================================================================
+
+    static constexpr float kMaxSigma = 1.5f;
+    static constexpr float kSigmaPerRadius = 1.414f;
+
+    // Gaussian sigma, in pixels, for p.radius at a render scale
+    static float sigma(const Params& p, double scale) {
+        return std::max(0.1f, kSigmaPerRadius * (float)(p.radius * scale));
+    }
+
+    // Halvings of the luma before the kernel fits sigma
+    static int levels(float s) {
+        int n = 0;
+        for (; s > kMaxSigma; s *= 0.5f)
+            ++n;
+        return n;
+    }
+
+    // Taps either side of the centre for sigma s <= kMaxSigma
+    static int taps(float s) {
+        return std::min(3, std::max(1, (int)std::ceil(2.0f * s)));
+    }
+
+    // ========================================================================
+    // Edge Aware — guided filter
+    //
+    // Edge Aware blurs the luma with a self-guided filter (He et al.): in
+    // each window of radius guidedRadius the luma is fitted as a * L + b,
+    // with a = var / (var + eps). Across an edge a is near 1, so the edge
+    // passes through unblurred and yields no detail, hence no halo; in flat
+    // or textured areas it falls to the box mean. Means and variances are
+    // Utils box filters, so the cost does not depend on the radius. Edge
+    // Protection sets eps, the variance below which detail counts as
+    // texture to be sharpened.
+    // ========================================================================
+
+    static int guidedRadius(const Params& p, double scale) {
+        return std::max(1, (int)std::ceil(2.0f * sigma(p, scale)));
+    }
+
+    // eps as a standard deviation: 0.05 unprotected, down to 0.01
+    static float guidedEps(const Params& p) {
+        const float prot =
+            (float)std::min(std::max(p.edgeProtection, 0.0), 1.0);
+        const float e = 0.05f - 0.04f * prot;
+        return e * e;
+    }
+
+    // Box-filter a plane in place, through tmp
+    static void boxFilter(float* plane, float* tmp, int w, int h, int r,
+                          const Utils::Scheduler* sched) {
+        Utils::boxBlurH(plane, tmp, w, h, r, sched);
+        Utils::boxBlurV(tmp, plane, w, h, r, sched);
+    }
+
+    // Per-pixel guided filter coefficients of luma: the window means of a
+    // into ca and of b into cb, so the filtered luma is ca * L + cb
+    static void guided(const float* luma, float* ca, float* cb, float* tmp,
+                       int w, int h, int r, float eps,
+                       const Utils::Scheduler* sched) {
+        auto rows = [&](auto fn) {
+            Utils::parallelFor(sched, (h + 63) / 64, [&](int chunk) {
+                const size_t i0 = (size_t)chunk * 64 * w;
+                const size_t i1 =
+                    std::min((size_t)(chunk + 1) * 64, (size_t)h) * w;
+                for (size_t i = i0; i < i1; ++i)
+                    fn(i);
+            });
+        };
+        rows([&](size_t i) {
+            ca[i] = luma[i] * luma[i];
+            cb[i] = luma[i];
+        });
+        boxFilter(ca, tmp, w, h, r, sched);
+        boxFilter(cb, tmp, w, h, r, sched);
+        rows([&](size_t i) {
+            const float mean = cb[i];
+            const float var = std::max(ca[i] - mean * mean, 0.0f);
+            const float a = var / (var + eps);
+            ca[i] = a;
+            cb[i] = mean - a * mean;
+        });
+        boxFilter(ca, tmp, w, h, r, sched);
+        boxFilter(cb, tmp, w, h, r, sched);
+    }
+
+    // Pixels the blurred luma reaches on either side: the kernel at its
+    // level plus a pixel of that level each for the downsample and upsample
+    // (Edge Aware: two box windows)
+    static int reach(const Params& p, double scale) {
+        if (p.type == eEdgeAware)
+            return 2 * guidedRadius(p, scale);
+        float s = sigma(p, scale);
+        const int n = levels(s);
+        s = std::ldexp(s, -n);
+        return (taps(s) + (n > 0 ? 2 : 0)) << n;
+    }
+
+    // Rows [y0, y1) and columns [x0, x1) of a w x h plane convolved with
+    // the 2K + 1 taps wt (centre first) along both axes, edge-extended;
+    // emit(y, row) receives each filtered row, x0 at row[0]. Chunks of rows
+    // are independent: each primes its own ring of horizontally filtered
+    // rows, so only the plane is shared.
+    template <int K, class Emit>
+    static void convolve(const float* src, int w, int h, int x0, int y0,
+                         int x1, int y1, const float* wt,
+                         const Utils::Scheduler* sched, Emit emit) {
+        const int n = x1 - x0;
+        // Columns whose taps all fall inside the row
+        const int xa = std::min(std::max(x0, K), x1);
+        const int xb = std::max(std::min(x1, w - K), xa);
+        const int rows = 64;
+        Utils::parallelFor(sched, (y1 - y0 + rows - 1) / rows, [&](int chunk) {
+            const int ya = y0 + chunk * rows;
+            const int yb = std::min(y1, ya + rows);
+            float c[K + 1]; // Taps in registers, not reloaded past stores
+            std::copy(wt, wt + K + 1, c);
+            std::vector<float> ring((size_t)(2 * K + 2) * n);
+            float* out = ring.data() + (size_t)(2 * K + 1) * n;
+            auto slot = [&](int y) {
+                const int i = (y + 2 * K + 1) % (2 * K + 1);
+                return ring.data() + (size_t)i * n;
+            };
+            // Horizontal taps of source row y into its slot
+            auto filterRow = [&](int y) {
+                const float* __restrict__ s =
+                    src + (size_t)std::min(std::max(y, 0), h - 1) * w;
+                float* __restrict__ d = slot(y) - x0;
+                auto edge = [&](int x) {
+                    float acc = c[0] * s[x];
+                    for (int k = 1; k <= K; ++k)
+                        acc += c[k] * (s[std::max(x - k, 0)] +
+                                       s[std::min(x + k, w - 1)]);
+                    d[x] = acc;
+                };
+                for (int x = x0; x < xa; ++x)
+                    edge(x);
+                for (int x = xa; x < xb; ++x) {
+                    float acc = c[0] * s[x];
+                    for (int k = 1; k <= K; ++k)
+                        acc += c[k] * (s[x - k] + s[x + k]);
+                    d[x] = acc;
+                }
+                for (int x = xb; x < x1; ++x)
+                    edge(x);
+            };
+            for (int y = ya - K; y < ya + K; ++y)
+                filterRow(y);
+            for (int y = ya; y < yb; ++y) {
+                filterRow(y + K);
+                const float* __restrict__ mid = slot(y);
+                const float* up[K];
+                const float* dn[K];
+                for (int k = 1; k <= K; ++k) {
+                    up[k - 1] = slot(y - k);
+                    dn[k - 1] = slot(y + k);
+                }
+                float* __restrict__ o = out;
+                for (int i = 0; i < n; ++i) {
+                    float acc = c[0] * mid[i];
+                    for (int k = 1; k <= K; ++k)
+                        acc += c[k] * (up[k - 1][i] + dn[k - 1][i]);
+                    o[i] = acc;
+                }
+                emit(y, out);
+            }
+        });
+    }
+
+    // Dispatch convolve on the tap count for sigma s <= kMaxSigma
+    template <class Emit>
+    static void convolve(const float* src, int w, int h, int x0, int y0,
+                         int x1, int y1, float s,
+                         const Utils::Scheduler* sched, Emit emit) {
+        const int k = taps(s);
+        float wt[4];
+        float sum = 0.0f;
+        for (int i = 0; i <= k; ++i) {
+            wt[i] = std::exp(-0.5f * (float)(i * i) / (s * s));
+            sum += i ? 2.0f * wt[i] : wt[i];
+        }
+        for (int i = 0; i <= k; ++i)
+            wt[i] /= sum;
+        if (k == 1)
+            convolve<1>(src, w, h, x0, y0, x1, y1, wt, sched, emit);
+        else if (k == 2)
+            convolve<2>(src, w, h, x0, y0, x1, y1, wt, sched, emit);
+        else
+            convolve<3>(src, w, h, x0, y0, x1, y1, wt, sched, emit);
+    }
+
+    // Sharpen img in place over [x0, x1) x [y0, y1); the rest of img is
+    // read as the blur's neighbourhood. scratch holds three planes of img's
+    // size (luma and the blur or its coefficients), tmp one.
+    static void process(PlanarImage& img, PlanarImage& scratch,
+                        PlanarImage& tmp, int x0, int y0, int x1, int y1,
+                        const Params& p, double scale,
+                        const Utils::Scheduler* sched = nullptr) {
+        const int w = img.width();
+        const int h = img.height();
+        float* const r = img.plane(0);
+        float* const g = img.plane(1);
+        float* const b = img.plane(2);
+        float* const luma = scratch.plane(0);
+        Utils::parallelFor(sched, (h + 63) / 64, [&](int chunk) {
+            const size_t i0 = (size_t)chunk * 64 * w;
+            const size_t i1 = std::min((size_t)(chunk + 1) * 64, (size_t)h) * w;
+            for (size_t i = i0; i < i1; ++i)
+                luma[i] = Utils::getLuminance(r[i], g[i], b[i]);
+        });
+
+        auto sharpenRow = [&](int y, const float* bL) {
+            const size_t base = (size_t)y * w + x0;
+            for (int i = 0; i < x1 - x0; ++i)
+                applySharpen(r[base + i], g[base + i], b[base + i], bL[i], p);
+        };
+
+        if (p.type == eEdgeAware) {
+            float* const ca = scratch.plane(1);
+            float* const cb = scratch.plane(2);
+            guided(luma, ca, cb, tmp.plane(0), w, h, guidedRadius(p, scale),
+                   guidedEps(p), sched);
+            Utils::parallelFor(sched, (y1 - y0 + 63) / 64, [&](int chunk) {
+                std::vector<float> bL(x1 - x0);
+                const int ya = y0 + chunk * 64;
+                for (int y = ya; y < std::min(y1, ya + 64); ++y) {
+                    const size_t base = (size_t)y * w + x0;
+                    for (int i = 0; i < x1 - x0; ++i)
+                        bL[i] = ca[base + i] * luma[base + i] + cb[base + i];
+                    sharpenRow(y, bL.data());
+                }
+            });
+            return;
+        }
+
+        float s = sigma(p, scale);
+        const int n = levels(s);
+        if (n == 0) {
+            convolve(luma, w, h, x0, y0, x1, y1, s, sched, sharpenRow);
+            return;
+        }
+
+        // Halve n times, blur the top level, then upsample back to full size
+        std::vector<int> lw(n + 1), lh(n + 1);
+        std::vector<std::vector<float>> down(n + 1), up(n + 1);
+        lw[0] = w;
+        lh[0] = h;
+        const float* prev = luma;
+        for (int l = 1; l <= n; ++l) {
+            lw[l] = (lw[l - 1] + 1) / 2;
+            lh[l] = (lh[l - 1] + 1) / 2;
+            down[l].resize((size_t)lw[l] * lh[l]);
+            Utils::downsample2x(prev, down[l].data(), lw[l - 1], lh[l - 1],
+                                sched);
+            prev = down[l].data();
+        }
+        up[n].resize(down[n].size());
+        convolve(down[n].data(), lw[n], lh[n], 0, 0, lw[n], lh[n],
+                 std::ldexp(s, -n), sched, [&](int y, const float* row) {
+                     std::copy(row, row + lw[n],
+                               up[n].data() + (size_t)y * lw[n]);
+                 });
+        for (int l = n - 1; l >= 0; --l) {
+            float* dst = scratch.plane(1);
+            if (l > 0) {
+                up[l].resize((size_t)lw[l] * lh[l]);
+                dst = up[l].data();
+            }
+            Utils::upsample2xBilinear(up[l + 1].data(), dst, lw[l], lh[l],
+                                      sched);
+        }
+        const float* blurred = scratch.plane(1);
+        Utils::parallelFor(sched, (y1 - y0 + 63) / 64, [&](int chunk) {
+            const int ya = y0 + chunk * 64;
+            for (int y = ya; y < std::min(y1, ya + 64); ++y)
+                sharpenRow(y, blurred + (size_t)y * w + x0);
+        });
+    }
 };
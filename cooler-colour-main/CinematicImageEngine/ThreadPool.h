@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed-size worker pool for the standalone renderer and the plugin.
+ *
+ * cie_render has no host threads, so frames in flight and the strips inside
+ * each frame share one of these. The plugin renders its slices on the
+ * host's threads and fans the blurs inside them out onto one.
+ *
+ * parallelFor() lets the calling thread work through the range as well, and
+ * only waits on indices already claimed by a running worker. Nested calls
+ * (a frame task fanning out into strips) therefore cannot deadlock even when
+ * every worker is busy.
+ */
+class ThreadPool {
+public:
+  // 0 threads = one per hardware thread
+  explicit ThreadPool(unsigned threads = 0) : _stop(false) {
+    if (threads == 0)
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    _workers.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i)
+      _workers.emplace_back([this] { workerLoop(); });
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _cv.notify_all();
+    for (std::thread &t : _workers)
+      t.join();
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  unsigned size() const { return (unsigned)_workers.size(); }
+
+  void submit(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _tasks.push_back(std::move(task));
+    }
+    _cv.notify_one();
+  }
+
+  // Runs fn(i) for every i in [0, n) and returns when all have finished.
+  template <class Fn> void parallelFor(int n, Fn fn) {
+    if (n <= 0)
+      return;
+    if (n == 1) {
+      fn(0);
+      return;
+    }
+
+    struct Batch {
+      std::atomic<int> next{0};
+      std::atomic<int> done{0};
+      int count = 0;
+      std::mutex mutex;
+      std::condition_variable cv;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->count = n;
+
+    // Helpers that start after the range is exhausted return without
+    // touching fn, so capturing it by reference is safe.
+    auto run = [batch, &fn] {
+      int i;
+      while ((i = batch->next.fetch_add(1)) < batch->count) {
+        fn(i);
+        if (batch->done.fetch_add(1) + 1 == batch->count) {
+          std::lock_guard<std::mutex> lock(batch->mutex);
+          batch->cv.notify_all();
+        }
+      }
+    };
+
+    const int helpers = std::min(n - 1, (int)size());
+    for (int h = 0; h < helpers; ++h)
+      submit(run);
+    run();
+
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->cv.wait(lock, [&] { return batch->done.load() == batch->count; });
+  }
+
+private:
+  void workerLoop() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _stop || !_tasks.empty(); });
+        if (_stop && _tasks.empty())
+          return;
+        task = std::move(_tasks.front());
+        _tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread> _workers;
+  std::deque<std::function<void()>> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _stop;
+};
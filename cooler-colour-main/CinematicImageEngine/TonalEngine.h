@@ -1,5 +1,7 @@
 #pragma once
 
+#include "CurveTable.h"
+#include "FastMath.h"
 #include <algorithm>
 #include <cmath>
 
@@ -31,13 +33,34 @@ public:
   static void processPixel(float *r, float *g, float *b, const Params &params) {
     if (params.strength <= 0.0)
       return;
+    const float L = 0.2126f * (*r) + 0.7152f * (*g) + 0.0722f * (*b);
+    applyRatio(r, g, b, L, mapLuminance(L, params));
+  }
 
-    float R = *r;
-    float G = *g;
-    float B = *b;
+  // Same, with the curve read from a table baked by bakeCurve(). Values
+  // outside the table fall back to mapLuminance.
+  static void processPixel(float *r, float *g, float *b, const Params &params,
+                           const CurveTable::Table &curve) {
+    if (params.strength <= 0.0)
+      return;
+    const float L = 0.2126f * (*r) + 0.7152f * (*g) + 0.0722f * (*b);
+    float L_out;
+    if (!CurveTable::lookup(curve, L, L_out))
+      L_out = mapLuminance(L, params);
+    applyRatio(r, g, b, L, L_out);
+  }
 
-    float L = 0.2126f * R + 0.7152f * G + 0.0722f * B;
+  static void bakeCurve(CurveTable::Table &curve, const Params &params) {
+    if (params.strength <= 0.0) {
+      curve.data.clear();
+      return;
+    }
+    CurveTable::bake(curve,
+                     [&](float L) { return mapLuminance(L, params); });
+  }
 
+  // Luminance in -> luminance out: pivot curve, strength, floor, soft clip
+  static float mapLuminance(float L, const Params &params) {
     const float epsilon = 1e-7f;
     float safePivot = (float)std::max(params.pivot, 1e-4);
 
@@ -45,7 +68,7 @@ public:
     if (L <= safePivot) {
       // Below pivot: standard power curve
       float Ln = std::max(L / safePivot, epsilon);
-      float Lc = std::pow(Ln, (float)params.contrast);
+      float Lc = FastMath::pow(Ln, (float)params.contrast);
       L_mapped = Lc * safePivot;
     } else {
       // Above pivot: independent highlight contrast
@@ -54,7 +77,7 @@ public:
         range = epsilon;
       float Ln = (L - safePivot) / range;
       float hContrast = (float)std::max(params.highlightContrast, 0.01);
-      float Lc = std::pow(std::max(Ln, epsilon), hContrast);
+      float Lc = FastMath::pow(std::max(Ln, epsilon), hContrast);
       L_mapped = safePivot + Lc * range;
     }
 
@@ -72,11 +95,14 @@ public:
       float k = (float)params.softClip * 2.0f;
       // Soft clip near 0 (floor) and near 1 (ceiling)
       if (L_out > 0.0f && L_out < 1.0f) {
-        // Upper soft clip: compress values approaching 1.0
-        float headroom = 1.0f - L_out;
-        if (headroom < k * 0.5f) {
-          float excess = k * 0.5f - headroom;
-          L_out = 1.0f - (k * 0.5f) / (1.0f + excess * 4.0f);
+        // Upper soft clip: compress values approaching 1.0, i.e.
+        // 1 - (k/2) / (1 + 4 * excess) past the knee at 1 - k/2, written
+        // without the 1 - x cancellation that loses near-black precision
+        // when the knee is at 0
+        float knee = 1.0f - k * 0.5f;
+        if (L_out > knee) {
+          float excess = L_out - knee;
+          L_out = (knee + excess * 4.0f) / (1.0f + excess * 4.0f);
         }
       } else if (L_out >= 1.0f) {
         // Already above 1 — compress with asymptotic curve
@@ -84,12 +110,17 @@ public:
         L_out = std::min(L_out, 1.0f);
       }
     }
+    return L_out;
+  }
 
-    // RGB Reapplication (Preserve Chroma)
+private:
+  // RGB Reapplication (Preserve Chroma)
+  static void applyRatio(float *r, float *g, float *b, float L, float L_out) {
+    const float epsilon = 1e-7f;
     float ratio = L_out / std::max(L, epsilon);
 
-    *r = R * ratio;
-    *g = G * ratio;
-    *b = B * ratio;
+    *r *= ratio;
+    *g *= ratio;
+    *b *= ratio;
   }
 };
@@ -3,8 +3,13 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <functional>
+#include <type_traits>
 #include <vector>
 
+#include "Half.h"
+#include "PlanarImage.h"
+
 namespace Utils {
 
 // ============================================================================
@@ -24,116 +29,205 @@ inline float getLuminance(float r, float g, float b) {
 
 inline float mix(float x, float y, float a) { return x * (1.0f - a) + y * a; }
 
+// ============================================================================
+// Row storage — float planes are used in place; fp16 planes (uint16_t
+// binary16) are widened into a float scratch row and narrowed back, so every
+// accumulator and intermediate sum stays fp32.
+// ============================================================================
+
+inline const float *widenRow(const float *src, float *, size_t) { return src; }
+inline const float *widenRow(const uint16_t *src, float *scratch, size_t n) {
+  Half::toFloat(src, scratch, n);
+  return scratch;
+}
+
+// Where to write a row bound for dst: dst itself, or scratch for fp16
+inline float *rowTarget(float *dst, float *) { return dst; }
+inline float *rowTarget(uint16_t *, float *scratch) { return scratch; }
+
+// Complete a write made through rowTarget
+inline void narrowRow(float *, const float *, size_t) {}
+inline void narrowRow(uint16_t *dst, const float *src, size_t n) {
+  Half::fromFloat(src, dst, n);
+}
+
+// Clamp a row bound for T to its finite range, so an extreme highlight
+// cannot become inf in fp16 and spread through a blur. No-op for float.
+inline void saturateRow(float *, float *, size_t) {}
+inline void saturateRow(uint16_t *, float *row, size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    row[i] = std::min(std::max(row[i], -65504.0f), 65504.0f);
+}
+
+// Scratch floats a row operation on T needs (none for float)
+template <class T> inline size_t scratchSize(size_t n) {
+  return std::is_same<T, float>::value ? 0 : n;
+}
+
+// ============================================================================
+// Scheduler — optional parallel-for hook for the filters below
+// ============================================================================
+
+// run(n, fn) calls fn(i) once for every i in [0, n), in any order and
+// possibly concurrently, and returns when all have finished (e.g. a
+// ThreadPool::parallelFor). Filters split their work into chunks whose
+// layout depends only on the image size, never on the scheduler, so the
+// result is bit-identical to the serial path. Null or empty = serial.
+struct Scheduler {
+  std::function<void(int, const std::function<void(int)> &)> run;
+};
+
+inline void parallelFor(const Scheduler *sched, int n,
+                        const std::function<void(int)> &fn) {
+  if (sched && sched->run && n > 1) {
+    sched->run(n, fn);
+    return;
+  }
+  for (int i = 0; i < n; ++i)
+    fn(i);
+}
+
+// Rows per horizontal chunk: about 256 KB of source, a multiple of 4 so
+// chunks keep the serial path's 4-row grouping
+inline int chunkRows(int w, size_t elemSize) {
+  const size_t rows = (256 * 1024) / std::max<size_t>(1, (size_t)w * elemSize);
+  return std::max(4, (int)(rows & ~(size_t)3));
+}
+
 // ============================================================================
 // Fast O(N) Box Blur — Production-Grade Implementation
 //
-// Key improvements over Phase 1:
+// All filters work on one plane (see PlanarImage.h), float or fp16; the
+// PlanarImageT overloads below run them over every plane. Single-channel
+// planes keep each pass unit-stride and SIMD-friendly, and carry no alpha.
 //   1. __restrict__ pointers for auto-vectorization
-//   2. Cache-friendly vertical blur (strip-based, 8-column tiles)
-//   3. Eliminated redundant final memcpy via ping-pong reordering
+//   2. Horizontal pass slides four rows at once (independent add chains)
+//   3. Vertical pass slides whole row segments (vectorised accumulators)
+//   4. Gaussian ping-pong ends in dst without a final memcpy
+//   5. Rows / column strips split across an optional Scheduler
 // ============================================================================
 
-// --- Horizontal box blur: O(W*H), radius-independent ---
-// src and dst must NOT alias.
-inline void boxBlurH(const float *__restrict__ src, float *__restrict__ dst,
-                     int w, int h, int r) {
-  if (r < 1) {
-    std::memcpy(dst, src, (size_t)w * h * 4 * sizeof(float));
-    return;
+// Slide a box of radius r along N rows at once; the rows' accumulators are
+// independent, so their adds overlap instead of waiting on each other.
+template <int N>
+inline void boxBlurHRows(const float *__restrict__ src, float *__restrict__ dst,
+                         int w, int r, float invK) {
+  float sum[N];
+  for (int k = 0; k < N; ++k) {
+    const float *row = src + (size_t)k * w;
+    sum[k] = row[0] * (r + 1);
+    for (int i = 1; i <= r; ++i)
+      sum[k] += row[std::min(i, w - 1)];
   }
-  const float invK = 1.0f / (float)(2 * r + 1);
-  const int stride = w * 4;
 
-  for (int y = 0; y < h; ++y) {
-    const float *row = src + y * stride;
-    float *out = dst + y * stride;
-
-    // Seed accumulators with clamped border samples
-    float sumR = row[0] * (r + 1);
-    float sumG = row[1] * (r + 1);
-    float sumB = row[2] * (r + 1);
-    for (int i = 1; i <= r; ++i) {
-      int px = std::min(i, w - 1) * 4;
-      sumR += row[px + 0];
-      sumG += row[px + 1];
-      sumB += row[px + 2];
+  for (int x = 0; x < w; ++x) {
+    const int addIdx = std::min(x + r + 1, w - 1);
+    const int subIdx = std::max(x - r, 0);
+    for (int k = 0; k < N; ++k) {
+      const float *row = src + (size_t)k * w;
+      dst[(size_t)k * w + x] = sum[k] * invK;
+      sum[k] += row[addIdx] - row[subIdx];
     }
+  }
+}
 
-    for (int x = 0; x < w; ++x) {
-      out[x * 4 + 0] = sumR * invK;
-      out[x * 4 + 1] = sumG * invK;
-      out[x * 4 + 2] = sumB * invK;
-      out[x * 4 + 3] = row[x * 4 + 3]; // alpha passthrough
-
-      // Advance the sliding window
-      int addIdx = std::min(x + r + 1, w - 1) * 4;
-      int subIdx = std::max(x - r, 0) * 4;
-      sumR += row[addIdx + 0] - row[subIdx + 0];
-      sumG += row[addIdx + 1] - row[subIdx + 1];
-      sumB += row[addIdx + 2] - row[subIdx + 2];
-    }
+// Rows [y0, y1) of a horizontal pass; y0 a multiple of 4
+template <class T>
+inline void boxBlurHRange(const T *__restrict__ src, T *__restrict__ dst,
+                          int w, int r, int y0, int y1) {
+  const float invK = 1.0f / (float)(2 * r + 1);
+  std::vector<float> scratch(scratchSize<T>((size_t)8 * w));
+  float *in = scratch.data();
+  float *out = in + (size_t)4 * w;
+
+  // Four rows are contiguous, so they widen / narrow in one call
+  int y = y0;
+  for (; y + 4 <= y1; y += 4) {
+    const size_t off = (size_t)y * w;
+    float *o = rowTarget(dst + off, out);
+    boxBlurHRows<4>(widenRow(src + off, in, (size_t)4 * w), o, w, r, invK);
+    narrowRow(dst + off, o, (size_t)4 * w);
+  }
+  for (; y < y1; ++y) {
+    const size_t off = (size_t)y * w;
+    float *o = rowTarget(dst + off, out);
+    boxBlurHRows<1>(widenRow(src + off, in, w), o, w, r, invK);
+    narrowRow(dst + off, o, w);
   }
 }
 
-// --- Cache-friendly vertical box blur: strip-based (8-column tiles) ---
-// Processes columns in groups of STRIP_W to keep accumulators in L1 cache.
-// At 4K (w=3840), naive column traversal has stride ~61KB (3840*4*4 bytes),
-// which thrashes L1. Strip-based reduces working set to ~256 bytes per strip.
-inline void boxBlurV(const float *__restrict__ src, float *__restrict__ dst,
-                     int w, int h, int r) {
+// --- Horizontal box blur: O(W*H), radius-independent ---
+// src and dst must NOT alias.
+template <class T>
+inline void boxBlurH(const T *__restrict__ src, T *__restrict__ dst, int w,
+                     int h, int r, const Scheduler *sched = nullptr) {
   if (r < 1) {
-    std::memcpy(dst, src, (size_t)w * h * 4 * sizeof(float));
+    std::memcpy(dst, src, (size_t)w * h * sizeof(T));
     return;
   }
-  const float invK = 1.0f / (float)(2 * r + 1);
-  const int stride = w * 4;
-
-  // Process columns in strips of 8 for cache locality
-  static constexpr int STRIP_W = 8;
-  const int channelsPerStrip = STRIP_W * 4; // 32 floats = 128 bytes
-
-  for (int x0 = 0; x0 < w; x0 += STRIP_W) {
-    const int cols = std::min(STRIP_W, w - x0);
-    const int chans = cols * 4;
+  const int rows = chunkRows(w, sizeof(T));
+  parallelFor(sched, (h + rows - 1) / rows, [&](int i) {
+    boxBlurHRange(src, dst, w, r, i * rows, std::min(h, (i + 1) * rows));
+  });
+}
 
-    // Accumulator arrays — small enough for L1/registers
-    float sums[channelsPerStrip]; // max 32 floats = 128 bytes
+// --- Vertical box blur: row-segment sliding window ---
+// The accumulators for a segment of STRIP_W columns live in a small array
+// updated a whole row segment at a time, so every step is a contiguous
+// vector add with long runs for the prefetcher, and the working set
+// (accumulators plus the add/sub/out row segments) stays in L1 however
+// wide the frame is. Strips are independent and are the parallel chunks.
+static constexpr int kBlurStripW = 1024; // 4 KB of accumulators
+
+// One strip [x0, x0 + cols) of a vertical pass
+template <class T>
+inline void boxBlurVStrip(const T *__restrict__ src, T *__restrict__ dst,
+                          int w, int h, int r, int x0, int cols) {
+  const float invK = 1.0f / (float)(2 * r + 1);
+  float sums[kBlurStripW];
+  std::vector<float> scratch(scratchSize<T>((size_t)3 * kBlurStripW));
+  float *scratchAdd = scratch.data();
+  float *scratchSub = scratchAdd + kBlurStripW;
+  float *scratchOut = scratchSub + kBlurStripW;
+
+  // Seed accumulators: first pixel * (r+1) + pixels 1..r
+  const float *first = widenRow(src + x0, scratchAdd, cols);
+  for (int c = 0; c < cols; ++c)
+    sums[c] = first[c] * (r + 1);
+  for (int i = 1; i <= r; ++i) {
+    const float *p =
+        widenRow(src + (size_t)std::min(i, h - 1) * w + x0, scratchAdd, cols);
+    for (int c = 0; c < cols; ++c)
+      sums[c] += p[c];
+  }
 
-    // Seed accumulators: first pixel * (r+1) + pixels 1..r
-    for (int c = 0; c < chans; ++c) {
-      sums[c] = src[x0 * 4 + c] * (r + 1);
-    }
-    for (int i = 1; i <= r; ++i) {
-      int py = std::min(i, h - 1);
-      const float *p = src + py * stride + x0 * 4;
-      for (int c = 0; c < chans; ++c) {
-        sums[c] += p[c];
-      }
+  // Slide vertically
+  for (int y = 0; y < h; ++y) {
+    T *dstRow = dst + (size_t)y * w + x0;
+    float *__restrict__ out = rowTarget(dstRow, scratchOut);
+    const float *__restrict__ pAdd = widenRow(
+        src + (size_t)std::min(y + r + 1, h - 1) * w + x0, scratchAdd, cols);
+    const float *__restrict__ pSub =
+        widenRow(src + (size_t)std::max(y - r, 0) * w + x0, scratchSub, cols);
+    for (int c = 0; c < cols; ++c) {
+      out[c] = sums[c] * invK;
+      sums[c] += pAdd[c] - pSub[c];
     }
+    narrowRow(dstRow, out, cols);
+  }
+}
 
-    // Slide vertically
-    for (int y = 0; y < h; ++y) {
-      float *out = dst + y * stride + x0 * 4;
-      const float *srcRow = src + y * stride + x0 * 4;
-
-      // Write output
-      for (int c = 0; c < chans; c += 4) {
-        out[c + 0] = sums[c + 0] * invK;
-        out[c + 1] = sums[c + 1] * invK;
-        out[c + 2] = sums[c + 2] * invK;
-        out[c + 3] = srcRow[c + 3]; // alpha passthrough
-      }
-
-      // Advance sliding window
-      int addY = std::min(y + r + 1, h - 1);
-      int subY = std::max(y - r, 0);
-      const float *pAdd = src + addY * stride + x0 * 4;
-      const float *pSub = src + subY * stride + x0 * 4;
-      for (int c = 0; c < chans; ++c) {
-        sums[c] += pAdd[c] - pSub[c];
-      }
-    }
+template <class T>
+inline void boxBlurV(const T *__restrict__ src, T *__restrict__ dst, int w,
+                     int h, int r, const Scheduler *sched = nullptr) {
+  if (r < 1) {
+    std::memcpy(dst, src, (size_t)w * h * sizeof(T));
+    return;
   }
+  parallelFor(sched, (w + kBlurStripW - 1) / kBlurStripW, [&](int i) {
+    const int x0 = i * kBlurStripW;
+    boxBlurVStrip(src, dst, w, h, r, x0, std::min(kBlurStripW, w - x0));
+  });
 }
 
 // --- Compute ideal box radii for 3-pass Gaussian approximation ---
@@ -157,28 +251,20 @@ inline void boxRadiiForGaussian(float sigma, int radii[3]) {
   }
 }
 
-// --- Fast Gaussian blur with external temp buffer (no allocation) ---
+// --- Fast Gaussian blur with external temp plane (no allocation) ---
 //
 // src = input,  dst = output,  tmp = scratch (same size as src/dst)
-// All three must be pre-allocated.
-// Safe for in-place use (src == dst): handled by using tmp as initial copy.
-inline void gaussianBlur(const float *src, float *dst, float *tmp, int w, int h,
-                         int r) {
+// Safe for in-place use (src == dst): the first horizontal pass reads all
+// of src before anything is written to dst.
+template <class T>
+inline void gaussianBlur(const T *src, T *dst, T *tmp, int w, int h, int r,
+                         const Scheduler *sched = nullptr) {
   if (r < 1) {
     if (src != dst)
-      std::memcpy(dst, src, (size_t)w * h * 4 * sizeof(float));
+      std::memcpy(dst, src, (size_t)w * h * sizeof(T));
     return;
   }
 
-  const size_t bufBytes = (size_t)w * h * 4 * sizeof(float);
-
-  // Handle in-place (src == dst): copy to tmp first, use tmp as source.
-  const float *actualSrc = src;
-  if (src == dst) {
-    std::memcpy(tmp, src, bufBytes);
-    actualSrc = tmp;
-  }
-
   float sigma = (float)r / 2.0f;
   if (sigma < 0.1f)
     sigma = 0.1f;
@@ -186,39 +272,171 @@ inline void gaussianBlur(const float *src, float *dst, float *tmp, int w, int h,
   int radii[3];
   boxRadiiForGaussian(sigma, radii);
 
-  // 3-pass box blur, ping-ponging between dst and tmp.
-  // Ordered so the final vertical pass writes directly to dst (no extra copy).
-  // Pass 1: actualSrc → dst (H), dst → tmp (V)
-  boxBlurH(actualSrc, dst, w, h, radii[0]);
-  boxBlurV(dst, tmp, w, h, radii[0]);
-
-  // Pass 2: tmp → dst (H), dst → tmp (V)
-  boxBlurH(tmp, dst, w, h, radii[1]);
-  boxBlurV(dst, tmp, w, h, radii[1]);
-
-  // Pass 3: tmp → dst (H), then dst → dst via tmp
-  // H: tmp → dst, V: dst → ... we need result in dst.
-  // Reorder: H into tmp, V into dst.
-  boxBlurH(tmp, dst, w, h, radii[2]);
-  // We need V to read from dst and write elsewhere, then land in dst.
-  // But boxBlurV requires non-aliased src/dst. So: H→tmp, V→dst.
-  // Actually: do H: tmp→tmp via dst as scratch? No.
-  // Simplest correct approach: H writes to dst, copy dst→tmp, V writes to dst.
-  std::memcpy(tmp, dst, bufBytes);
-  boxBlurV(tmp, dst, w, h, radii[2]);
-}
-
-// --- Convenience overload that allocates its own temp buffer ---
-// Prefer the 3-argument version when a shared scratch buffer is available.
-inline void gaussianBlur(const float *src, float *dst, int w, int h, int r) {
+  // 3-pass box blur: each pass H into tmp, V back into dst
+  boxBlurH(src, tmp, w, h, radii[0], sched);
+  boxBlurV(tmp, dst, w, h, radii[0], sched);
+  boxBlurH(dst, tmp, w, h, radii[1], sched);
+  boxBlurV(tmp, dst, w, h, radii[1], sched);
+  boxBlurH(dst, tmp, w, h, radii[2], sched);
+  boxBlurV(tmp, dst, w, h, radii[2], sched);
+}
+
+// --- Single-pass box blur matched to the Gaussian's sigma (Draft quality) ---
+//
+// One H + V box pass whose variance equals that of the 3-pass Gaussian at
+// the same radius. Visibly boxier, but a third of the memory traffic.
+// Same aliasing rules as gaussianBlur (src == dst allowed).
+inline int fastBoxRadius(int r) {
+  float sigma = std::max(0.1f, (float)r / 2.0f);
+  int br = (int)std::round((std::sqrt(12.0f * sigma * sigma + 1.0f) - 1.0f) *
+                           0.5f);
+  return std::max(1, br);
+}
+
+template <class T>
+inline void fastBoxBlur(const T *src, T *dst, T *tmp, int w, int h, int r,
+                        const Scheduler *sched = nullptr) {
   if (r < 1) {
     if (src != dst)
-      std::memcpy(dst, src, (size_t)w * h * 4 * sizeof(float));
+      std::memcpy(dst, src, (size_t)w * h * sizeof(T));
     return;
   }
 
-  std::vector<float> tmp((size_t)w * h * 4);
-  gaussianBlur(src, dst, tmp.data(), w, h, r);
+  const int br = fastBoxRadius(r);
+  boxBlurH(src, tmp, w, h, br, sched);
+  boxBlurV(tmp, dst, w, h, br, sched);
+}
+
+// --- 2x box downsample ---
+// dst must hold ((w+1)/2) * ((h+1)/2) values. Odd edges clamp.
+template <class T>
+inline void downsample2x(const T *__restrict__ src, T *__restrict__ dst, int w,
+                         int h, const Scheduler *sched = nullptr) {
+  const int dw = (w + 1) / 2;
+  const int dh = (h + 1) / 2;
+  const int rows = chunkRows(2 * w, sizeof(T));
+
+  parallelFor(sched, (dh + rows - 1) / rows, [&](int chunk) {
+    std::vector<float> scratch(scratchSize<T>((size_t)2 * w + dw));
+    for (int y = chunk * rows; y < std::min(dh, (chunk + 1) * rows); ++y) {
+      const float *r0 =
+          widenRow(src + (size_t)(2 * y) * w, scratch.data(), w);
+      const float *r1 = widenRow(src + (size_t)std::min(2 * y + 1, h - 1) * w,
+                                 scratch.data() + w, w);
+      T *dstRow = dst + (size_t)y * dw;
+      float *out = rowTarget(dstRow, scratch.data() + 2 * w);
+      for (int x = 0; x < dw; ++x) {
+        const int i0 = 2 * x;
+        const int i1 = std::min(2 * x + 1, w - 1);
+        out[x] = 0.25f * (r0[i0] + r0[i1] + r1[i0] + r1[i1]);
+      }
+      narrowRow(dstRow, out, dw);
+    }
+  });
+}
+
+// --- 2x bilinear upsample, inverse of downsample2x ---
+// src is ((w+1)/2) x ((h+1)/2); dst is w x h. Pixel-centre aligned, so
+// every output pixel sits a quarter of a source pixel from its nearest
+// source pixel: the weights are always 3/4 and 1/4. Each output row blends
+// its two source rows, then the blended row is expanded to even (left
+// neighbour) and odd (right neighbour) outputs. Edges clamp.
+template <class T>
+inline void upsample2xBilinear(const T *__restrict__ src, T *__restrict__ dst,
+                               int w, int h, const Scheduler *sched = nullptr) {
+  const int sw = (w + 1) / 2;
+  const int sh = (h + 1) / 2;
+  const int rows = chunkRows(w, sizeof(T));
+
+  parallelFor(sched, (h + rows - 1) / rows, [&](int chunk) {
+    std::vector<float> scratch(scratchSize<T>((size_t)2 * sw + w) + sw + 2);
+    float *const r0s = scratch.data();
+    float *const r1s = r0s + scratchSize<T>(sw);
+    float *const outs = r1s + scratchSize<T>(sw);
+    float *const v = outs + scratchSize<T>(w); // blended row, edge padded
+    for (int y = chunk * rows; y < std::min(h, (chunk + 1) * rows); ++y) {
+      // Even rows lean on the row above, odd rows on the row below
+      const int j = y >> 1;
+      const int jn = (y & 1) ? std::min(j + 1, sh - 1) : std::max(j - 1, 0);
+      const float *r0 = widenRow(src + (size_t)j * sw, r0s, sw);
+      const float *r1 = widenRow(src + (size_t)jn * sw, r1s, sw);
+      for (int x = 0; x < sw; ++x)
+        v[x + 1] = 0.75f * r0[x] + 0.25f * r1[x];
+      v[0] = v[1];
+      v[sw + 1] = v[sw];
+
+      T *dstRow = dst + (size_t)y * w;
+      float *out = rowTarget(dstRow, outs);
+      const int pairs = w / 2;
+      for (int x = 0; x < pairs; ++x) {
+        out[2 * x] = 0.75f * v[x + 1] + 0.25f * v[x];
+        out[2 * x + 1] = 0.75f * v[x + 1] + 0.25f * v[x + 2];
+      }
+      if (w & 1)
+        out[w - 1] = 0.75f * v[sw] + 0.25f * v[sw - 1];
+      narrowRow(dstRow, out, w);
+    }
+  });
+}
+
+// ============================================================================
+// PlanarImageT overloads — every plane the images share. Planes are
+// scheduled concurrently as well, each splitting its own passes.
+// ============================================================================
+
+template <class T>
+inline int sharedPlanes(const PlanarImageT<T> &a, const PlanarImageT<T> &b) {
+  return std::min(a.channels(), b.channels());
+}
+
+// dst and tmp must match src's size; src == dst allowed
+template <class T>
+inline void gaussianBlur(const PlanarImageT<T> &src, PlanarImageT<T> &dst,
+                         PlanarImageT<T> &tmp, int r,
+                         const Scheduler *sched = nullptr) {
+  parallelFor(sched, sharedPlanes(src, dst), [&](int c) {
+    gaussianBlur(src.plane(c), dst.plane(c), tmp.plane(c), src.width(),
+                 src.height(), r, sched);
+  });
+}
+
+template <class T>
+inline void fastBoxBlur(const PlanarImageT<T> &src, PlanarImageT<T> &dst,
+                        PlanarImageT<T> &tmp, int r,
+                        const Scheduler *sched = nullptr) {
+  parallelFor(sched, sharedPlanes(src, dst), [&](int c) {
+    fastBoxBlur(src.plane(c), dst.plane(c), tmp.plane(c), src.width(),
+                src.height(), r, sched);
+  });
+}
+
+// Horizontal only; src and dst must not alias
+template <class T>
+inline void boxBlurH(const PlanarImageT<T> &src, PlanarImageT<T> &dst, int r,
+                     const Scheduler *sched = nullptr) {
+  parallelFor(sched, sharedPlanes(src, dst), [&](int c) {
+    boxBlurH(src.plane(c), dst.plane(c), src.width(), src.height(), r, sched);
+  });
+}
+
+// dst must be ((w+1)/2) x ((h+1)/2) of src
+template <class T>
+inline void downsample2x(const PlanarImageT<T> &src, PlanarImageT<T> &dst,
+                         const Scheduler *sched = nullptr) {
+  parallelFor(sched, sharedPlanes(src, dst), [&](int c) {
+    downsample2x(src.plane(c), dst.plane(c), src.width(), src.height(), sched);
+  });
+}
+
+// dst's size sets the output; src must be ((w+1)/2) x ((h+1)/2) of it
+template <class T>
+inline void upsample2xBilinear(const PlanarImageT<T> &src,
+                               PlanarImageT<T> &dst,
+                               const Scheduler *sched = nullptr) {
+  parallelFor(sched, sharedPlanes(src, dst), [&](int c) {
+    upsample2xBilinear(src.plane(c), dst.plane(c), dst.width(), dst.height(),
+                       sched);
+  });
 }
 
 } // namespace Utils
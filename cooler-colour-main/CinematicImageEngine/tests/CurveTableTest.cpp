@@ -0,0 +1,113 @@
+// Bakes the Tonal Engine curve and the Highlight Protection roll-off for
+// representative parameter sets (pivots, soft clip, black floor, steep
+// roll-offs) and checks that every CurveTable::lookup hit is within
+// kTolerance of the curve it was baked from. The table domain is walked
+// by float bit pattern: every 61st pattern by default, every one with
+// --exhaustive.
+
+#include "../HighlightProtection.h"
+#include "../TonalEngine.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+int g_failures = 0;
+
+// Checks lookup(v) against fn(v) over the whole table domain. Misses are
+// fine (the caller evaluates fn), but the tables exist to be hit, so most
+// of the domain must be.
+template <class Fn>
+void check(const char *name, const CurveTable::Table &table, Fn fn,
+           uint32_t stride) {
+  const uint32_t lo = CurveTable::baseBits();
+  const uint32_t hi = CurveTable::bits((float)(1 << CurveTable::kMaxExp));
+  double worst = 0.0;
+  float worstV = 0.0f;
+  uint64_t hits = 0, total = 0;
+  for (uint64_t u = lo; u < hi; u += stride) {
+    const float v = CurveTable::fromBits((uint32_t)u);
+    ++total;
+    float got;
+    if (!CurveTable::lookup(table, v, got))
+      continue;
+    ++hits;
+    const float ref = fn(v);
+    const double ratio = std::fabs((double)got - ref) /
+                         (CurveTable::kTolerance * std::fabs((double)ref));
+    if (!(ratio <= worst)) {
+      worst = std::isnan(ratio) ? INFINITY : ratio;
+      worstV = v;
+    }
+  }
+
+  // Outside the domain lookup must always miss
+  float out;
+  const bool outsideMissed =
+      !CurveTable::lookup(table, CurveTable::fromBits(lo - 1), out) &&
+      !CurveTable::lookup(table, (float)(1 << CurveTable::kMaxExp), out) &&
+      !CurveTable::lookup(table, -1.0f, out) &&
+      !CurveTable::lookup(table, 0.0f, out);
+
+  const double hitRate = (double)hits / (double)total;
+  const bool ok = worst <= 1.0 && hitRate >= 0.9 && outsideMissed;
+  std::printf("%-28s %s worst %.3f of kTolerance at %.9g, %.1f%% hits\n",
+              name, ok ? "ok  " : "FAIL", worst, (double)worstV,
+              100.0 * hitRate);
+  if (!ok)
+    ++g_failures;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const uint32_t stride =
+      argc > 1 && std::strcmp(argv[1], "--exhaustive") == 0 ? 1 : 61;
+
+  // contrast, pivot, strength, blackFloor, highlightContrast, softClip
+  struct Tonal {
+    const char *name;
+    TonalEngine::Params params;
+  };
+  static const Tonal tonal[] = {
+      {"tonal identity", {1.0, 0.18, 1.0, 0.0, 1.0, 0.0}},
+      {"tonal contrast", {1.4, 0.18, 1.0, 0.0, 1.0, 0.0}},
+      {"tonal flat, high pivot", {0.7, 0.45, 1.0, 0.0, 1.3, 0.0}},
+      {"tonal low pivot", {1.8, 0.02, 1.0, 0.0, 0.6, 0.0}},
+      {"tonal pivot above 1", {1.2, 2.0, 1.0, 0.0, 1.0, 0.0}},
+      {"tonal floor + soft clip", {1.2, 0.18, 1.0, 0.01, 1.1, 0.3}},
+      {"tonal half, full soft clip", {1.5, 0.18, 0.5, 0.0, 0.8, 1.0}},
+      {"tonal light soft clip", {1.0, 0.18, 1.0, 0.0, 1.0, 0.05}},
+  };
+  for (const Tonal &t : tonal) {
+    CurveTable::Table table;
+    TonalEngine::bakeCurve(table, t.params);
+    check(t.name, table,
+          [&](float L) { return TonalEngine::mapLuminance(L, t.params); },
+          stride);
+  }
+
+  // threshold, rolloff, preserveColor
+  struct Highlight {
+    const char *name;
+    HighlightProtection::Params params;
+  };
+  static const Highlight highlight[] = {
+      {"highlight default", {0.8, 0.5, true}},
+      {"highlight at 1, steep", {1.0, 2.0, true}},
+      {"highlight low, very steep", {0.01, 10.0, false}},
+      {"highlight superwhite", {100.0, 0.1, true}},
+  };
+  for (const Highlight &h : highlight) {
+    CurveTable::Table table;
+    HighlightProtection::bakeCurve(table, h.params);
+    check(h.name, table,
+          [&](float v) { return HighlightProtection::compress(v, h.params); },
+          stride);
+  }
+
+  return g_failures == 0 ? 0 : 1;
+}
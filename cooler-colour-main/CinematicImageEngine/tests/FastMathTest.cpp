@@ -0,0 +1,201 @@
+// Sweeps each FastMath::Approx function, scalar and array form, over its
+// documented input domain and checks the maximum errors stated in
+// FastMath.h against double precision. Domains are walked by float bit
+// pattern, so every binade is covered evenly: every 1009th pattern by
+// default (about 2e6 values per function), every one with --exhaustive.
+
+#include "../FastMath.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+namespace {
+
+int g_failures = 0;
+
+// Worst error seen, as a fraction of the allowed error
+struct Worst {
+  const char *name;
+  double ratio = 0.0;
+  float x = 0.0f;
+
+  void add(float at, double r) {
+    if (!(r <= ratio)) { // also catches NaN
+      ratio = std::isnan(r) ? INFINITY : r;
+      x = at;
+    }
+  }
+
+  void report() {
+    const bool ok = ratio <= 1.0;
+    std::printf("%-7s %s worst %.3f of bound at x = %.9g\n", name,
+                ok ? "ok  " : "FAIL", ratio, (double)x);
+    if (!ok)
+      ++g_failures;
+  }
+};
+
+float fromBits(uint32_t u) {
+  float x;
+  std::memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+uint32_t bits(float x) {
+  uint32_t u;
+  std::memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+// Floats from lo to hi (both >= 0, both included) by bit pattern, every
+// `stride` patterns, negated when `negate`
+struct Range {
+  float lo, hi;
+  bool negate;
+};
+
+// One unit in the last place of the float nearest v
+double ulp(double v) {
+  const float f = (float)std::fabs(v);
+  return (double)std::nextafter(f, FLT_MAX) - (double)f;
+}
+
+// Error of `got` for input x as a fraction of the documented bound
+
+// log2: absolute 1.2e-7 + 1 ulp of the result
+double log2Err(float x, float got) {
+  const double ref = std::log2((double)x);
+  return std::fabs(got - ref) / (1.2e-7 + ulp(ref));
+}
+
+// exp2: relative 2.5e-7
+double exp2Err(float x, float got) {
+  const double ref = std::exp2((double)x);
+  return std::fabs(got - ref) / ref / 2.5e-7;
+}
+
+// pow: relative 4e-7 + 1e-7 * |y log2 x|
+double powErr(float x, float y, float got) {
+  const double lg = (double)y * std::log2((double)x);
+  const double ref = std::exp2(lg);
+  return std::fabs(got - ref) / ref / (4e-7 + 1e-7 * std::fabs(lg));
+}
+
+// tanh: relative 4.2e-7 and absolute 2.1e-7
+double tanhErr(float x, float got) {
+  const double ref = std::tanh((double)x);
+  const double err = std::fabs(got - ref);
+  return std::max(err / 2.1e-7, ref != 0.0 ? err / std::fabs(ref) / 4.2e-7
+                                           : err / 4.2e-7);
+}
+
+// rsqrt: relative 4.8e-6
+double rsqrtErr(float x, float got) {
+  const double ref = 1.0 / std::sqrt((double)x);
+  return std::fabs(got - ref) / ref / 4.8e-6;
+}
+
+// Checks the scalar function and the array form on every x in the ranges
+// that `keep` accepts. Works in chunks: the exhaustive sweep is 2^31 floats.
+template <class Scalar, class Array, class Err, class Keep>
+void check(const char *name, std::initializer_list<Range> ranges,
+           uint32_t stride, Scalar scalar, Array array, Err err, Keep keep) {
+  const size_t kChunk = 1 << 16;
+  Worst s{name}, a{"  (N)"};
+  std::vector<float> xs, out(kChunk);
+  xs.reserve(kChunk);
+  auto flush = [&] {
+    array(xs.data(), out.data(), (int)xs.size());
+    for (size_t i = 0; i < xs.size(); ++i) {
+      s.add(xs[i], err(xs[i], scalar(xs[i])));
+      a.add(xs[i], err(xs[i], out[i]));
+    }
+    xs.clear();
+  };
+  auto push = [&](float x) {
+    if (!keep(x))
+      return;
+    xs.push_back(x);
+    if (xs.size() == kChunk)
+      flush();
+  };
+  for (const Range &r : ranges) {
+    for (uint64_t u = bits(r.lo); u < bits(r.hi); u += stride)
+      push(r.negate ? -fromBits((uint32_t)u) : fromBits((uint32_t)u));
+    push(r.negate ? -r.hi : r.hi);
+  }
+  flush();
+  s.report();
+  a.report();
+}
+
+template <class Scalar, class Array, class Err>
+void check(const char *name, std::initializer_list<Range> ranges,
+           uint32_t stride, Scalar scalar, Array array, Err err) {
+  check(name, ranges, stride, scalar, array, err, [](float) { return true; });
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const uint32_t stride =
+      argc > 1 && std::strcmp(argv[1], "--exhaustive") == 0 ? 1 : 1009;
+  using namespace FastMath;
+
+  // log2: x in [FLT_MIN, FLT_MAX]; rsqrt: x in [2^-125, 2^125]
+  check("log2", {{FLT_MIN, FLT_MAX, false}}, stride, Approx::log2,
+        Approx::log2N, log2Err);
+  check("rsqrt", {{std::ldexp(1.0f, -125), std::ldexp(1.0f, 125), false}},
+        stride, Approx::rsqrt, Approx::rsqrtN, rsqrtErr);
+
+  // exp2: x in [-126, 127]
+  check("exp2", {{0.0f, 127.0f, false}, {FLT_MIN, 126.0f, true}}, stride,
+        Approx::exp2, Approx::exp2N, exp2Err);
+
+  // tanh: all x of both signs. Denormal inputs are left out: the Release
+  // build flushes them to zero (-ffast-math), which is not an error of the
+  // approximation.
+  check("tanh",
+        {{0.0f, 0.0f, false},
+         {FLT_MIN, FLT_MAX, false},
+         {FLT_MIN, FLT_MAX, true},
+         {INFINITY, INFINITY, false},
+         {INFINITY, INFINITY, true}},
+        stride, Approx::tanh, Approx::tanhN, [](float x, float got) {
+          return std::isinf(x)
+                     ? std::fabs(got - (x > 0 ? 1.0 : -1.0)) / 2.1e-7
+                     : tanhErr(x, got);
+        });
+
+  // pow: x > 0 with a result in [2^-126, 2^127], for the gammas and
+  // contrasts the modules use; 0 for x <= 0
+  static const float ys[] = {-3.0f, -2.2f, -1.0f, -0.4545f, 0.1f,
+                             0.4545f, 1.0f, 1.7f, 2.2f, 3.0f};
+  for (float y : ys) {
+    char name[24];
+    std::snprintf(name, sizeof(name), "pow^%g", (double)y);
+    check(
+        name, {{FLT_MIN, FLT_MAX, false}}, stride,
+        [y](float x) { return Approx::pow(x, y); },
+        [y](const float *in, float *out, int n) {
+          Approx::powN(in, y, out, n);
+        },
+        [y](float x, float got) { return powErr(x, y, got); },
+        [y](float x) {
+          const double lg = (double)y * std::log2((double)x);
+          return lg >= -126.0 && lg <= 127.0;
+        });
+
+    Worst z{"  (x<=0)"};
+    for (float x : {0.0f, -0.0f, -FLT_MIN, -1.0f, -FLT_MAX})
+      z.add(x, Approx::pow(x, y) == 0.0f ? 0.0 : INFINITY);
+    z.report();
+  }
+
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,186 @@
+// Renders looks with the spatial modules through Pipeline::processWindow
+// once as the whole frame and once as a grid of odd-sized tiles, the way
+// an OFX host or cie_render slices a render, and checks that the two
+// agree. Every tile gets its own apron buffer, so anything phased on the
+// buffer origin (pyramid levels, half-resolution grids, resampling
+// lattices) shows up as a difference.
+//
+// Running sums start at different buffer edges in the two renders, so the
+// results only agree to float rounding: the check is relative to the
+// pixel value, at kTolerance. Draft's box over a long streak sums a couple
+// of thousand taps and uses about a third of it.
+
+#include "../Pipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+namespace {
+
+const float kTolerance = 1e-4f;
+
+// A source frame and the tile grid it is rendered in. Tile edges are odd
+// sizes, so tile origins land on every phase of the pyramids' power-of-two
+// grids and of a star's line lattice.
+struct Frame {
+  int w, h;
+  std::vector<int> cols, rows; // Tile edges, from 0 to w / h
+  std::vector<float> px;       // RGBA
+};
+
+int g_failures = 0;
+
+uint32_t hash(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7feb352du;
+  x ^= x >> 15;
+  x *= 0x846ca68bu;
+  x ^= x >> 16;
+  return x;
+}
+
+float unit(uint32_t x) { return (float)(hash(x) >> 8) / 16777216.0f; }
+
+// Scene-linear test frame: soft gradients, texture, and sparse highlights
+// from 2 to 40 so thresholds, HDR ranges and streaks all have work to do
+Frame makeFrame(int w, int h, std::vector<int> cols, std::vector<int> rows) {
+  Frame f = {w, h, std::move(cols), std::move(rows), {}};
+  f.px.resize((size_t)w * h * 4);
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      const uint32_t i = (uint32_t)(y * w + x);
+      float *p = &f.px[(size_t)i * 4];
+      const float base = 0.05f + 0.4f * (float)x / w * (float)y / h;
+      for (int c = 0; c < 3; ++c)
+        p[c] = base * (0.7f + 0.6f * unit(i * 3 + c));
+      if (hash(i ^ 0x9e3779b9u) % 211 == 0) {
+        const float hot = 2.0f + 38.0f * unit(i + 77);
+        p[0] = hot;
+        p[1] = hot * 0.8f;
+        p[2] = hot * 0.6f;
+      }
+      p[3] = 1.0f;
+    }
+  }
+  return f;
+}
+
+std::vector<float> render(const Pipeline &p, Frame &src, bool tiled) {
+  std::vector<float> dst(src.px.size(), 0.0f);
+  const Pipeline::Rect bounds = {0, 0, src.w, src.h};
+  const ptrdiff_t rowBytes = (ptrdiff_t)src.w * 4 * sizeof(float);
+  const Pipeline::ImageView s = {src.px.data(), bounds, rowBytes};
+  const Pipeline::ImageView d = {dst.data(), bounds, rowBytes};
+  if (!tiled) {
+    p.processWindow(s, d, bounds);
+    return dst;
+  }
+  for (size_t j = 0; j + 1 < src.rows.size(); ++j)
+    for (size_t i = 0; i + 1 < src.cols.size(); ++i)
+      p.processWindow(s, d, {src.cols[i], src.rows[j], src.cols[i + 1],
+                             src.rows[j + 1]});
+  return dst;
+}
+
+void check(const char *name, const std::function<void(Pipeline &)> &look,
+           Frame &src) {
+  for (int quality : {eQualityDraft, eQualityFinal}) {
+    Pipeline p;
+    p.setSourceRoD({0.0, 0.0, (double)src.w, (double)src.h});
+    p.setQuality(quality);
+    look(p);
+    p.prepareFrame();
+    const std::vector<float> full = render(p, src, false);
+    const std::vector<float> tiled = render(p, src, true);
+
+    double worst = 0.0, worstAbs = 0.0;
+    size_t at = 0;
+    for (size_t i = 0; i < full.size(); ++i) {
+      const double err = std::fabs((double)tiled[i] - full[i]);
+      const double ratio =
+          err / (kTolerance * std::max(1.0f, std::fabs(full[i])));
+      if (!(ratio <= worst)) {
+        worst = std::isnan(ratio) ? INFINITY : ratio;
+        worstAbs = err;
+        at = i / 4;
+      }
+    }
+    const bool ok = worst <= 1.0;
+    std::printf("%-22s %-5s %s worst %.3g of tolerance (abs %.3g at %d,%d)\n",
+                name, quality == eQualityDraft ? "Draft" : "Final",
+                ok ? "ok  " : "FAIL", worst, worstAbs, (int)(at % src.w),
+                (int)(at / src.w));
+    if (!ok)
+      ++g_failures;
+  }
+}
+
+} // namespace
+
+int main() {
+  Frame src = makeFrame(416, 288, {0, 93, 211, 250, 416},
+                        {0, 37, 101, 164, 229, 288});
+
+  check("glow", [](Pipeline &p) {
+    p.glow = {true, 0.6, 0.8, 0.5, 40.0, 0.5, 0.0,
+              CinematicGlow::eSingle, 6, 0.6, 0.0};
+  }, src);
+  check("bloom", [](Pipeline &p) {
+    p.glow = {true, 0.6, 0.8, 0.5, 90.0, 0.5, 0.2,
+              CinematicGlow::eBloom, 6, 0.6, 0.3};
+  }, src);
+  check("mist", [](Pipeline &p) {
+    p.mist = {true, 0.8, 0.5, 0.5, 0.0, 0.2, 0.0};
+  }, src);
+  check("dreamy blur", [](Pipeline &p) {
+    p.blur = {true, 30.0, 0.7, 0.3, 0.8, 0.5, 1.0};
+  }, src);
+  check("dreamy blur small", [](Pipeline &p) {
+    p.blur = {true, 4.0, 0.5, 0.3, 0.8, 0.5, 1.0};
+  }, src);
+  check("halation", [](Pipeline &p) {
+    p.halo = {true, 0.7, 0.8, 0.5, 0.3, 25.0, 1.0,
+              Halation::eSpectral, {3.0, 1.5, 0.5}};
+  }, src);
+  check("streak", [](Pipeline &p) {
+    p.streak = {true, 0.5, 0.8, 0.5, 0.2, 0, 0.0, {}, {}};
+  }, src);
+  check("star", [](Pipeline &p) {
+    p.streak = {true, 0.5, 0.8, 0.6, 0.2, 2, 17.0, {0.4, 0.8, 0.0},
+                {-0.3, 0.0, 0.0}};
+  }, src);
+  check("stacked", [](Pipeline &p) {
+    p.mist = {true, 0.5, 0.5, 0.5, 0.0, 0.0, 0.0};
+    p.blur = {true, 20.0, 0.5, 0.3, 0.8, 0.5, 1.0};
+    p.glow = {true, 0.5, 0.8, 0.5, 60.0, 0.5, 0.0,
+              CinematicGlow::eBloom, 6, 0.6, 0.0};
+    p.halo = {true, 0.5, 0.8, 0.5, 0.3, 20.0, 1.0,
+              Halation::eUniform, {3.0, 1.5, 0.5}};
+  }, src);
+  check("ca classic", [](Pipeline &p) {
+    p.ca = {true, 0.6, 0.2, -0.1, ChromaticAberration::eClassic, 3};
+  }, src);
+  check("ca spectral", [](Pipeline &p) {
+    p.ca = {true, 0.6, 0.2, -0.1, ChromaticAberration::eSpectral, 6};
+  }, src);
+
+  // Streaks longer than 256 px run through a per-row pyramid; a frame much
+  // wider than their reach keeps tile buffers from covering it all
+  Frame wide = makeFrame(4800, 40, {0, 1211, 2333, 3100, 4800}, {0, 17, 40});
+  check("long streak", [](Pipeline &p) {
+    p.streak = {true, 0.5, 0.8, 8.0, 0.0, 0, 0.0, {}, {}};
+  }, wide);
+  // A shallow arm's lines cross the top and bottom of each tile's buffer
+  // at a different place, so every tile starts them at a different point.
+  // A window wider than the arm's horizontal reach reads such lines.
+  Frame tall = makeFrame(3200, 480, {0, 611, 3200}, {0, 101, 267, 480});
+  check("long star", [](Pipeline &p) {
+    p.streak = {true, 0.5, 0.8, 4.0, 0.0, 0, 4.0, {}, {}};
+  }, tall);
+
+  return g_failures == 0 ? 0 : 1;
+}
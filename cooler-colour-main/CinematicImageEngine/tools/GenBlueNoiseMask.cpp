@@ -0,0 +1,137 @@
+// Generates BlueNoiseMask.h: the ranks of a 128x128 void-and-cluster
+// threshold map (Ulichney 1993), toroidal so it tiles seamlessly.
+//
+//   c++ -O2 -std=c++14 tools/GenBlueNoiseMask.cpp -o gen && ./gen > BlueNoiseMask.h
+//
+// The build scans the whole tile for every one of its 16384 ranks (about
+// 1.6 s), which is why the plugin ships the table instead of building it
+// on the first render. Build it without -ffast-math: reassociated energy
+// sums break ties differently and move a few ranks.
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+static const int kMaskSize = 128;
+static const int kMaskMask = kMaskSize - 1;
+
+// Gaussian energy of the minority pixels, kept incrementally. Sigma 1.5
+// as in the original paper; the window wraps around the tile.
+struct EnergyField {
+  static const int kRadius = 6;
+  float kernel[2 * kRadius + 1][2 * kRadius + 1];
+  std::vector<float> energy;
+
+  EnergyField() : energy(kMaskSize * kMaskSize, 0.0f) {
+    for (int dy = -kRadius; dy <= kRadius; ++dy)
+      for (int dx = -kRadius; dx <= kRadius; ++dx)
+        kernel[dy + kRadius][dx + kRadius] =
+            std::exp(-(float)(dx * dx + dy * dy) / (2.0f * 1.5f * 1.5f));
+  }
+
+  void splat(int idx, float sign) {
+    const int x = idx & kMaskMask;
+    const int y = idx / kMaskSize;
+    for (int dy = -kRadius; dy <= kRadius; ++dy) {
+      const int row = ((y + dy) & kMaskMask) * kMaskSize;
+      for (int dx = -kRadius; dx <= kRadius; ++dx)
+        energy[row + ((x + dx) & kMaskMask)] +=
+            sign * kernel[dy + kRadius][dx + kRadius];
+    }
+  }
+
+  // Index of the highest (tightest cluster) or lowest (largest void)
+  // energy among pixels equal to `value`
+  int extreme(const std::vector<uint8_t> &bits, uint8_t value,
+              bool highest) const {
+    // Branch-free max pass (vectorises), then locate the first match
+    const int n = kMaskSize * kMaskSize;
+    const float sign = highest ? 1.0f : -1.0f;
+    float best = -1e30f;
+    for (int i = 0; i < n; ++i) {
+      const float v = bits[i] == value ? sign * energy[i] : -1e30f;
+      best = v > best ? v : best;
+    }
+    for (int i = 0; i < n; ++i)
+      if (bits[i] == value && sign * energy[i] == best)
+        return i;
+    return 0;
+  }
+};
+
+static std::vector<int> buildBlueNoiseRanks() {
+  const int n = kMaskSize * kMaskSize;
+  std::vector<uint8_t> bits(n, 0);
+  EnergyField field;
+
+  // Initial pattern: ~10 % of pixels from a fixed LCG, so the mask is the
+  // same on every host.
+  uint32_t state = 0x9E3779B9u;
+  int ones = 0;
+  while (ones < n / 10) {
+    state = state * 1664525u + 1013904223u;
+    const int i = (int)(state >> 18) % n;
+    if (!bits[i]) {
+      bits[i] = 1;
+      field.splat(i, 1.0f);
+      ++ones;
+    }
+  }
+
+  // Relax: move the tightest cluster into the largest void until stable
+  for (int iter = 0; iter < n; ++iter) {
+    const int cluster = field.extreme(bits, 1, true);
+    bits[cluster] = 0;
+    field.splat(cluster, -1.0f);
+    const int voidIdx = field.extreme(bits, 0, false);
+    bits[voidIdx] = 1;
+    field.splat(voidIdx, 1.0f);
+    if (voidIdx == cluster)
+      break;
+  }
+
+  std::vector<int> rank(n, 0);
+  const std::vector<uint8_t> initial = bits;
+  const EnergyField initialField = field;
+
+  // Phase 1: peel the initial pattern, tightest cluster first
+  for (int r = ones - 1; r >= 0; --r) {
+    const int cluster = field.extreme(bits, 1, true);
+    bits[cluster] = 0;
+    field.splat(cluster, -1.0f);
+    rank[cluster] = r;
+  }
+
+  // Phases 2-3: fill the largest void until the tile is full. Past half
+  // full this is the same as removing the tightest cluster of zeros, since
+  // the energies of ones and zeros sum to a constant.
+  bits = initial;
+  field = initialField;
+  for (int r = ones; r < n; ++r) {
+    const int voidIdx = field.extreme(bits, 0, false);
+    bits[voidIdx] = 1;
+    field.splat(voidIdx, 1.0f);
+    rank[voidIdx] = r;
+  }
+
+  return rank;
+}
+
+int main() {
+  const std::vector<int> rank = buildBlueNoiseRanks();
+  std::printf("#pragma once\n\n"
+              "#include <cstdint>\n\n"
+              "// Generated by tools/GenBlueNoiseMask.cpp; do not edit.\n"
+              "// Rank (0..16383) of each pixel of the 128x128 blue-noise "
+              "mask, row-major.\n\n"
+              "namespace Dither {\n\n"
+              "inline const uint16_t *blueNoiseRanks() {\n"
+              "  static const uint16_t kRanks[%d] = {\n",
+              kMaskSize * kMaskSize);
+  for (int i = 0; i < kMaskSize * kMaskSize; ++i)
+    std::printf("%s%d,%s", i % 12 == 0 ? "      " : " ", rank[i],
+                i % 12 == 11 ? "\n" : "");
+  std::printf("\n  };\n  return kRanks;\n}\n\n} // namespace Dither\n");
+  return 0;
+}